@@ -5,7 +5,9 @@
 #include <deque>
 #include <string>
 #include <Queue.h>
+#include <RingBuffer.h>
 #include <Stack.h>
+#include <StackBuffer.h>
 
 #include "ExpElem.h"
 
@@ -22,10 +24,10 @@ namespace siobko {
     long long calculate();
 
   private:
-    Queue< ExpElem > infixExp;
-    Queue< ExpElem > postfixExp;
-    Stack< ExpElem > stackOfOperands;
-    Stack< ExpElem > stackOfOperators;
+    Queue< ExpElem, RingBuffer< ExpElem > > infixExp;
+    Queue< ExpElem, RingBuffer< ExpElem > > postfixExp;
+    Stack< ExpElem, StackBuffer< ExpElem > > stackOfOperands;
+    Stack< ExpElem, StackBuffer< ExpElem > > stackOfOperators;
   };
 }
 #endif
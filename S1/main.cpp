@@ -1,6 +1,7 @@
 ﻿#include <iostream>
 #include <algorithm>
 #include <input.h>
+#include <output.h>
 
 #include "MathExp.h"
 
@@ -33,11 +34,18 @@ int main(int argc, char* argv[])
   }
 
   reverse(answers.begin(), answers.end());
-  if (!answers.empty()) {
-    for (size_t i = 0; i < answers.size() - 1; ++i) {
-      std::cout << answers[i] << " ";
+  try {
+    siobko::OutputWriter out(std::cout);
+    if (!answers.empty()) {
+      for (size_t i = 0; i < answers.size() - 1; ++i) {
+        out << answers[i] << ' ';
+      }
+      out << answers[answers.size() - 1];
     }
-    std::cout << answers[answers.size() - 1];
+    out << '\n';
+    out.flush();
+  } catch (const std::exception& err) {
+    std::cerr << err.what() << '\n';
+    return 1;
   }
-  std::cout << '\n';
 }
@@ -38,5 +38,13 @@ int main(int argc, char *argv[])
     return 1;
   }
 
-  std::cout << functor.keyResult << " " << functor.valueResult << '\n';
+  try {
+    siobko::OutputWriter out(std::cout);
+    out << functor.keyResult << ' ' << functor.valueResult << '\n';
+    out.flush();
+  }
+  catch (const std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return 1;
+  }
 }
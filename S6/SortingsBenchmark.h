@@ -0,0 +1,209 @@
+#ifndef SORTINGS_BENCHMARK_H
+#define SORTINGS_BENCHMARK_H
+
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+#include "Instrumentation.h"
+#include "Sortings.h"
+
+namespace siobko{
+  template< typename Ty, typename Compare >
+  class SortingsBenchmark {
+  public:
+    enum class Distribution {
+      RANDOM,
+      SORTED,
+      REVERSED,
+      FEW_UNIQUE,
+      ORGAN_PIPE,
+      SAWTOOTH,
+      ZIPF
+    };
+
+    SortingsBenchmark(std::size_t maxSize, std::size_t trials);
+    ~SortingsBenchmark() = default;
+
+    void run(std::ostream& out);
+
+  private:
+    template< typename Sorting >
+    void benchmarkSorting(std::ostream& out, const char *name, Sorting sorting);
+
+    std::vector< Ty > generate(Distribution distribution, std::size_t size);
+    double percentile(const std::vector< double >& sorted, double rank) const;
+
+    static constexpr std::size_t warmUps = 1u;
+    static constexpr std::size_t minBatchElements = 1u << 16;
+    static constexpr std::size_t fewUniqueValues = 16u;
+    static constexpr std::size_t sawtoothTeeth = 32u;
+    static constexpr std::size_t zipfMaxRanks = 1u << 20;
+
+    std::size_t maxSize_;
+    std::size_t trials_;
+    Distribution distribution_;
+    std::vector< Ty > data_;
+    std::mt19937_64 gen_;
+    Compare comp_;
+  };
+
+  template< typename Ty, typename Compare >
+  SortingsBenchmark< Ty, Compare >::SortingsBenchmark(std::size_t maxSize, std::size_t trials):
+    maxSize_(maxSize),
+    trials_(trials),
+    distribution_(Distribution::RANDOM),
+    data_(),
+    gen_(std::chrono::high_resolution_clock::now().time_since_epoch().count()),
+    comp_()
+  {
+    if (maxSize_ < 10u || trials_ == 0u) {
+      throw std::logic_error("Error: benchmark needs at least 10 elements and one trial.");
+    }
+  }
+
+  template< typename Ty, typename Compare >
+  std::vector< Ty > SortingsBenchmark< Ty, Compare >::generate(Distribution distribution, std::size_t size)
+  {
+    std::vector< Ty > data(size);
+    std::uniform_real_distribution< double > uniform(-1e9, 1e9);
+    switch (distribution) {
+    case Distribution::RANDOM:
+    case Distribution::SORTED:
+    case Distribution::REVERSED:
+      for (Ty& item: data) {
+        item = static_cast< Ty >(uniform(gen_));
+      }
+      if (distribution != Distribution::RANDOM) {
+        std::sort(data.begin(), data.end(), comp_);
+      }
+      if (distribution == Distribution::REVERSED) {
+        std::reverse(data.begin(), data.end());
+      }
+      break;
+    case Distribution::FEW_UNIQUE: {
+      std::uniform_int_distribution< std::size_t > value(0u, fewUniqueValues - 1u);
+      for (Ty& item: data) {
+        item = static_cast< Ty >(value(gen_) * 1000);
+      }
+      break;
+    }
+    case Distribution::ORGAN_PIPE:
+      for (std::size_t i = 0u; i < size; ++i) {
+        data[i] = static_cast< Ty >(std::min(i, size - 1u - i));
+      }
+      break;
+    case Distribution::SAWTOOTH: {
+      std::size_t period = std::max< std::size_t >(1u, size / sawtoothTeeth);
+      for (std::size_t i = 0u; i < size; ++i) {
+        data[i] = static_cast< Ty >(i % period);
+      }
+      break;
+    }
+    case Distribution::ZIPF: {
+      std::vector< double > cumulative(std::min(size, zipfMaxRanks));
+      double sum = 0.0;
+      for (std::size_t rank = 0u; rank < cumulative.size(); ++rank) {
+        sum += 1.0 / (rank + 1);
+        cumulative[rank] = sum;
+      }
+      std::uniform_real_distribution< double > probability(0.0, sum);
+      for (Ty& item: data) {
+        auto rank = std::upper_bound(cumulative.begin(), cumulative.end(), probability(gen_)) - cumulative.begin();
+        item = static_cast< Ty >(std::min< std::ptrdiff_t >(rank, cumulative.size() - 1));
+      }
+      break;
+    }
+    }
+    return data;
+  }
+
+  template< typename Ty, typename Compare >
+  double SortingsBenchmark< Ty, Compare >::percentile(const std::vector< double >& sorted, double rank) const
+  {
+    std::size_t index = static_cast< std::size_t >(std::lround(rank * (sorted.size() - 1u)));
+    return sorted[index];
+  }
+
+  template< typename Ty, typename Compare >
+  template< typename Sorting >
+  void SortingsBenchmark< Ty, Compare >::benchmarkSorting(std::ostream& out, const char *name, Sorting sorting)
+  {
+    std::size_t size = data_.size();
+    std::size_t batch = std::max< std::size_t >(1u, minBatchElements / size);
+    std::vector< std::vector< Ty > > copies(batch);
+    std::vector< double > times;
+    for (std::size_t trial = 0u; trial < warmUps + trials_; ++trial) {
+      for (std::vector< Ty >& copy: copies) {
+        copy = data_;
+      }
+      auto start = std::chrono::steady_clock::now();
+      for (std::vector< Ty >& copy: copies) {
+        sorting(copy, comp_, Identity());
+      }
+      std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+      if (!std::is_sorted(copies.front().begin(), copies.front().end(), comp_)) {
+        throw std::logic_error("Error: benchmarked sorting produced unsorted output.");
+      }
+      if (trial >= warmUps) {
+        times.push_back(elapsed.count() / batch);
+      }
+    }
+    std::sort(times.begin(), times.end());
+
+    OperationCounters& counters = operationCounters();
+    std::vector< Counted< Ty > > counted(data_.begin(), data_.end());
+    counters.reset();
+    sorting(counted, CountingCompare< Compare >(comp_, counters), CountedValue());
+
+    static const char *distributions[] = {"random", "sorted", "reversed", "few-unique", "organ-pipe", "sawtooth",
+      "zipf"};
+    double median = percentile(times, 0.5);
+    out << name << ',' << distributions[static_cast< std::size_t >(distribution_)] << ',' << size << ','
+        << trials_ << ',' << median << ',' << percentile(times, 0.1) << ',' << percentile(times, 0.9) << ','
+        << size / median << ',' << counters.comparisons << ',' << counters.copies << ',' << counters.moves << ','
+        << counters.swaps << '\n';
+  }
+
+  template< typename Ty, typename Compare >
+  void SortingsBenchmark< Ty, Compare >::run(std::ostream& out)
+  {
+    const Distribution distributions[] = {Distribution::RANDOM, Distribution::SORTED, Distribution::REVERSED,
+      Distribution::FEW_UNIQUE, Distribution::ORGAN_PIPE, Distribution::SAWTOOTH, Distribution::ZIPF};
+
+    out << "sorting,distribution,size,trials,median_seconds,p10_seconds,p90_seconds,elements_per_second,"
+        << "comparisons,copies,moves,swaps\n";
+    for (std::size_t size = 10u; size <= maxSize_; size *= 10u) {
+      for (Distribution distribution: distributions) {
+        distribution_ = distribution;
+        data_ = generate(distribution, size);
+        benchmarkSorting(out, "quickSort", [](auto& data, auto cmp, auto proj) {
+          quickSort(data.begin(), data.end(), cmp, proj);
+        });
+        benchmarkSorting(out, "mergeSort", [](auto& data, auto cmp, auto proj) {
+          mergeSort(data.begin(), data.end(), cmp, proj);
+        });
+        benchmarkSorting(out, "timSort", [](auto& data, auto cmp, auto proj) {
+          timSort(data.begin(), data.end(), cmp, proj);
+        });
+        benchmarkSorting(out, "bucketSort", [](auto& data, auto cmp, auto proj) {
+          bucketSort(data, data.size(), cmp, proj);
+        });
+        benchmarkSorting(out, "sampleSort", [](auto& data, auto cmp, auto proj) {
+          sampleSort(data.begin(), data.end(), cmp, proj);
+        });
+        benchmarkSorting(out, "radixSort", [](auto& data, auto cmp, auto proj) {
+          radixSort(data.begin(), data.end(), cmp, proj);
+        });
+        benchmarkSorting(out, "std::sort", [](auto& data, auto cmp, auto proj) {
+          std::sort(data.begin(), data.end(), detail::projectCompare(cmp, proj));
+        });
+      }
+    }
+  }
+}
+#endif
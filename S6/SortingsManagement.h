@@ -8,10 +8,14 @@
 #include <algorithm>
 #include <list>
 #include <chrono>
+#include <thread>
+#include <iomanip>
 
 #include "ForwardList.h"
 #include "List.h"
+#include "output.h"
 #include "Sortings.h"
+#include "ThreadPool.h"
 
 namespace siobko{
   template< typename Ty, typename Compare >
@@ -24,10 +28,17 @@ namespace siobko{
     void testBucketSort(std::ostream& out);
     void testQuickSort(std::ostream& out);
     void testMergeSort(std::ostream& out);
+    void testTimSort(std::ostream& out);
+    void testRadixSort(std::ostream& out);
+    void testSampleSort(std::ostream& out);
+    void testParallelSortings(std::ostream& out, std::size_t maxThreads);
 
   private:
+    template< typename Sorting >
+    double measure(Sorting sorting);
+
     template< typename Container >
-    void printStructure(Container c, std::ostream& out);
+    void printStructure(const Container& c, std::ostream& out);
 
     Ty generateRandom();
 
@@ -44,14 +55,16 @@ namespace siobko{
   }
   template< typename Ty, typename Compare >
   template< typename Container >
-  void SortingsManagement< Ty, Compare >::printStructure(Container c, std::ostream& out)
+  void SortingsManagement< Ty, Compare >::printStructure(const Container& c, std::ostream& out)
   {
+    OutputWriter writer(out);
     auto it = c.begin();
-    out << (*it++);
+    writer << (*it++);
     while (it != c.end()) {
-      out << " " << (*it++);
+      writer << ' ' << (*it++);
     }
-    out << '\n';
+    writer << '\n';
+    writer.flush();
   }
 
   template< typename Ty, typename Compare >
@@ -73,6 +86,9 @@ namespace siobko{
     testBucketSort(out);
     testQuickSort(out);
     testMergeSort(out);
+    testTimSort(out);
+    testRadixSort(out);
+    testSampleSort(out);
   }
 
   template< typename Ty, typename Compare >
@@ -115,6 +131,118 @@ namespace siobko{
     std::copy(container_.begin(), container_.end(), std::back_inserter(deque));
     mergeSort(deque.begin(), deque.end(), comp_);
     printStructure(deque, out);
+
+    List< Ty > list;
+    std::copy(container_.begin(), container_.end(), std::back_inserter(list));
+    list.sort(comp_);
+    printStructure(list, out);
+
+    ForwardList< Ty > frwdList;
+    std::copy(container_.begin(), container_.end(), std::front_inserter(frwdList));
+    frwdList.sort(comp_);
+    printStructure(frwdList, out);
+  }
+
+  template< typename Ty, typename Compare >
+  void SortingsManagement< Ty, Compare >::testTimSort(std::ostream& out)
+  {
+    std::deque< Ty > deque;
+    std::copy(container_.begin(), container_.end(), std::back_inserter(deque));
+    timSort(deque.begin(), deque.end(), comp_);
+    printStructure(deque, out);
+  }
+
+  template< typename Ty, typename Compare >
+  void SortingsManagement< Ty, Compare >::testRadixSort(std::ostream& out)
+  {
+    std::deque< Ty > deque;
+    std::copy(container_.begin(), container_.end(), std::back_inserter(deque));
+    radixSort(deque.begin(), deque.end(), comp_);
+    printStructure(deque, out);
+
+    std::vector< Ty > vector(container_);
+    radixSort(vector.begin(), vector.end(), comp_);
+    printStructure(vector, out);
+  }
+
+  template< typename Ty, typename Compare >
+  void SortingsManagement< Ty, Compare >::testSampleSort(std::ostream& out)
+  {
+    std::deque< Ty > deque;
+    std::copy(container_.begin(), container_.end(), std::back_inserter(deque));
+    sampleSort(deque.begin(), deque.end(), comp_);
+    printStructure(deque, out);
+
+    std::vector< Ty > vector(container_);
+    sampleSort(ExecutionPolicy::PARALLEL, vector.begin(), vector.end(), comp_);
+    printStructure(vector, out);
+  }
+
+  template< typename Ty, typename Compare >
+  template< typename Sorting >
+  double SortingsManagement< Ty, Compare >::measure(Sorting sorting)
+  {
+    std::vector< Ty > data(container_);
+    auto start = std::chrono::steady_clock::now();
+    sorting(data);
+    std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+    if (!std::is_sorted(data.begin(), data.end(), comp_)) {
+      throw std::logic_error("Error: parallel sorting produced unsorted output.");
+    }
+    return elapsed.count();
+  }
+
+  template< typename Ty, typename Compare >
+  void SortingsManagement< Ty, Compare >::testParallelSortings(std::ostream& out, std::size_t maxThreads)
+  {
+    Compare comp = comp_;
+    double sequential[6] = {
+      measure([comp](std::vector< Ty >& data) {
+        quickSort(data.begin(), data.end(), comp);
+      }),
+      measure([comp](std::vector< Ty >& data) {
+        mergeSort(data.begin(), data.end(), comp);
+      }),
+      measure([comp](std::vector< Ty >& data) {
+        bucketSort(data, data.size(), comp);
+      }),
+      measure([comp](std::vector< Ty >& data) {
+        sampleSort(data.begin(), data.end(), comp);
+      }),
+      measure([comp](std::vector< Ty >& data) {
+        radixSort(data.begin(), data.end(), comp);
+      }),
+      measure([comp](std::vector< Ty >& data) {
+        timSort(data.begin(), data.end(), comp);
+      })
+    };
+    const char *names[6] = {"quickSort", "mergeSort", "bucketSort", "sampleSort", "radixSort", "timSort"};
+
+    out << std::fixed << std::setprecision(6);
+    out << "sorting threads seconds speedup\n";
+    for (std::size_t i = 0u; i < 6u; ++i) {
+      out << names[i] << " sequential " << sequential[i] << " 1.000000\n";
+    }
+    for (std::size_t threads = 1u; threads <= maxThreads; threads *= 2) {
+      ThreadPool pool(threads - 1u);
+      double parallel[4] = {
+        measure([comp, &pool](std::vector< Ty >& data) {
+          quickSort(ExecutionPolicy::PARALLEL, data.begin(), data.end(), comp, defaultGrainSize, pool);
+        }),
+        measure([comp, &pool](std::vector< Ty >& data) {
+          mergeSort(ExecutionPolicy::PARALLEL, data.begin(), data.end(), comp, defaultGrainSize, pool);
+        }),
+        measure([comp, &pool](std::vector< Ty >& data) {
+          bucketSort(ExecutionPolicy::PARALLEL, data, data.size(), comp, defaultGrainSize, pool);
+        }),
+        measure([comp, &pool](std::vector< Ty >& data) {
+          sampleSort(ExecutionPolicy::PARALLEL, data.begin(), data.end(), comp, defaultGrainSize, pool);
+        })
+      };
+      for (std::size_t i = 0u; i < 4u; ++i) {
+        out << names[i] << ' ' << threads << ' ' << parallel[i] << ' ' << sequential[i] / parallel[i] << '\n';
+      }
+    }
   }
 }
 #endif
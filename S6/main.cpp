@@ -1,38 +1,183 @@
+#include "ExternalSort.h"
+#include "input.h"
+#include "output.h"
+#include "SortingsBenchmark.h"
 #include "SortingsManagement.h"
 
+namespace {
+  enum class Mode {
+    PRINT,
+    PARALLEL,
+    EXTERNAL,
+    BENCHMARK,
+    INPUT
+  };
+
+  const std::string sortingNames[] = {"quickSort", "mergeSort", "timSort", "bucketSort", "sampleSort", "radixSort"};
+
+  struct Settings {
+    Mode mode = Mode::PRINT;
+    std::size_t container_size = 0u;
+    std::size_t threads_amount = 1u;
+    std::size_t trials_amount = 5u;
+    std::string input;
+    std::string output;
+    std::string sorting;
+    siobko::ExternalSortOptions external;
+  };
+
+  template< typename Ty, typename Compare >
+  void sortNumbers(std::vector< Ty >& data, const std::string& sorting)
+  {
+    Compare cmp;
+    if (sorting == "quickSort") {
+      siobko::quickSort(data.begin(), data.end(), cmp);
+    } else if (sorting == "mergeSort") {
+      siobko::mergeSort(data.begin(), data.end(), cmp);
+    } else if (sorting == "timSort") {
+      siobko::timSort(data.begin(), data.end(), cmp);
+    } else if (sorting == "bucketSort") {
+      siobko::bucketSort(data, data.size(), cmp);
+    } else if (sorting == "sampleSort") {
+      siobko::sampleSort(data.begin(), data.end(), cmp);
+    } else {
+      siobko::radixSort(data.begin(), data.end(), cmp);
+    }
+  }
+
+  template< typename Ty >
+  std::vector< Ty > readNumbers(const std::string& input)
+  {
+    if (input.empty() || input == "-") {
+      return siobko::inputNumbers< Ty >(stdin);
+    }
+    siobko::detail::file_ptr file(std::fopen(input.c_str(), "r"));
+    if (!file) {
+      throw std::runtime_error("Error: cannot open file " + input + ".");
+    }
+    return siobko::inputNumbers< Ty >(file.get());
+  }
+
+  template< typename Ty, typename Compare >
+  void runSortings(const Settings& settings)
+  {
+    if (settings.mode == Mode::INPUT) {
+      std::vector< Ty > data = readNumbers< Ty >(settings.input);
+      sortNumbers< Ty, Compare >(data, settings.sorting);
+      siobko::OutputWriter out(stdout);
+      out.precision(siobko::OutputWriter::roundTripPrecision);
+      for (const Ty& item: data) {
+        out << item << '\n';
+      }
+      out.flush();
+      return;
+    }
+
+    if (settings.mode == Mode::EXTERNAL) {
+      auto start = std::chrono::steady_clock::now();
+      siobko::ExternalSortStats stats = siobko::externalSort< Ty >(settings.input, settings.output, Compare(),
+          settings.external);
+      std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+      siobko::OutputWriter out(std::cout);
+      out << "elements " << stats.elements << '\n';
+      out << "runs " << stats.runs << '\n';
+      out << "merge passes " << stats.mergePasses << '\n';
+      out << "seconds " << elapsed.count() << '\n';
+      out.flush();
+      return;
+    }
+
+    if (settings.mode == Mode::BENCHMARK) {
+      siobko::SortingsBenchmark< Ty, Compare > benchmark(settings.container_size, settings.trials_amount);
+      benchmark.run(std::cout);
+      return;
+    }
+
+    siobko::SortingsManagement< Ty, Compare > sortingsManagement(settings.container_size);
+    if (settings.mode == Mode::PARALLEL) {
+      sortingsManagement.testParallelSortings(std::cout, settings.threads_amount);
+    } else {
+      sortingsManagement.testSortings(std::cout);
+    }
+  }
+}
+
 int main(int argc, const char *argv[])
 {
-  if (argc != 4) {
+  Settings settings;
+  std::string mode = (argc > 1) ? argv[1] : "";
+  if (mode == "parallel") {
+    settings.mode = Mode::PARALLEL;
+  } else if (mode == "external") {
+    settings.mode = Mode::EXTERNAL;
+  } else if (mode == "benchmark") {
+    settings.mode = Mode::BENCHMARK;
+  } else if (mode == "input") {
+    settings.mode = Mode::INPUT;
+  }
+  int first_arg = (settings.mode == Mode::PRINT) ? 1 : 2;
+  bool valid_amount = (settings.mode == Mode::PRINT && argc == 4)
+      || ((settings.mode == Mode::PARALLEL || settings.mode == Mode::BENCHMARK) && (argc == 5 || argc == 6))
+      || (settings.mode == Mode::EXTERNAL && argc >= 6 && argc <= 8)
+      || (settings.mode == Mode::INPUT && (argc == 5 || argc == 6));
+  if (!valid_amount) {
     std::cerr << "Error: invalid amount of arguments.";
     return 1;
   }
 
-  std::string sorting_order(argv[1]);
-  std::string value_type(argv[2]);
-  std::size_t container_size;
+  std::string sorting_order(argv[first_arg]);
+  std::string value_type(argv[first_arg + 1]);
+  settings.threads_amount = std::max(1u, std::thread::hardware_concurrency());
   try {
-    container_size = std::stoul(argv[3]);
+    if (settings.mode == Mode::INPUT) {
+      settings.sorting = argv[4];
+      if (argc > 5) {
+        settings.input = argv[5];
+      }
+    } else if (settings.mode == Mode::EXTERNAL) {
+      settings.input = argv[4];
+      settings.output = argv[5];
+      if (argc > 6) {
+        settings.external.memoryBudget = std::stoul(argv[6]);
+      }
+    } else {
+      settings.container_size = std::stoul(argv[first_arg + 2]);
+      if (settings.mode == Mode::PARALLEL && argc == 6) {
+        settings.threads_amount = std::stoul(argv[5]);
+      } else if (settings.mode == Mode::BENCHMARK && argc == 6) {
+        settings.trials_amount = std::stoul(argv[5]);
+      }
+    }
   } catch (...) {
     std::cerr << "Error: invalid amount of numbers.";
     return 1;
   }
+  if (settings.mode == Mode::INPUT
+      && std::find(std::begin(sortingNames), std::end(sortingNames), settings.sorting) == std::end(sortingNames)) {
+    std::cerr << "Error: invalid sorting name.";
+    return 1;
+  }
+  if (settings.mode == Mode::EXTERNAL && argc > 7) {
+    std::string format(argv[7]);
+    if (format != "text" && format != "binary") {
+      std::cerr << "Error: invalid file format.";
+      return 1;
+    }
+    settings.external.format = (format == "binary") ? siobko::FileFormat::BINARY : siobko::FileFormat::TEXT;
+  }
 
   try {
     if (value_type == "ints") {
       if (sorting_order == "ascending") {
-        siobko::SortingsManagement< int, std::less<> > sortingsManagement(container_size);
-        sortingsManagement.testSortings(std::cout);
+        runSortings< int, std::less<> >(settings);
       } else {
-        siobko::SortingsManagement< int, std::greater<> > sortingsManagement(container_size);
-        sortingsManagement.testSortings(std::cout);
+        runSortings< int, std::greater<> >(settings);
       }
     } else if (value_type == "floats") {
       if (sorting_order == "ascending") {
-        siobko::SortingsManagement< double, std::less<> > sortingsManagement(container_size);
-        sortingsManagement.testSortings(std::cout);
+        runSortings< double, std::less<> >(settings);
       } else {
-        siobko::SortingsManagement< double, std::greater<> > sortingsManagement(container_size);
-        sortingsManagement.testSortings(std::cout);
+        runSortings< double, std::greater<> >(settings);
       }
     } else {
       std::cerr << "Error: invalid sorting strategy order.";
@@ -0,0 +1,133 @@
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <string>
+#include <ConcurrentQueues.h>
+
+namespace {
+  constexpr std::size_t maxBatchSize = 64;
+
+  double measureSpsc(std::size_t itemsAmount, std::size_t capacity, std::size_t batchSize)
+  {
+    siobko::SpscQueue< std::size_t > queue(capacity);
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&]() {
+      std::size_t items[maxBatchSize];
+      for (std::size_t sent = 0u; sent < itemsAmount;) {
+        std::size_t amount = std::min(batchSize, itemsAmount - sent);
+        for (std::size_t i = 0u; i < amount; ++i) {
+          items[i] = sent + i;
+        }
+        std::size_t pushed = 0u;
+        while (pushed < amount) {
+          std::size_t count = queue.push_batch(items + pushed, items + amount);
+          if (count == 0u) {
+            std::this_thread::yield();
+          }
+          pushed += count;
+        }
+        sent += amount;
+      }
+    });
+
+    std::size_t items[maxBatchSize];
+    for (std::size_t received = 0u; received < itemsAmount;) {
+      std::size_t count = queue.pop_batch(items, batchSize);
+      if (count == 0u) {
+        std::this_thread::yield();
+      }
+      received += count;
+    }
+    producer.join();
+
+    std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+    return itemsAmount / elapsed.count();
+  }
+
+  double measureMpmc(std::size_t itemsAmount, std::size_t capacity, std::size_t batchSize,
+      std::size_t producersAmount, std::size_t consumersAmount)
+  {
+    siobko::MpmcQueue< std::size_t > queue(capacity);
+    std::atomic< std::size_t > received(0u);
+    std::vector< std::thread > threads;
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t p = 0u; p < producersAmount; ++p) {
+      std::size_t share = itemsAmount / producersAmount + (p < itemsAmount % producersAmount ? 1u : 0u);
+      threads.emplace_back([&queue, share, batchSize]() {
+        std::size_t items[maxBatchSize];
+        for (std::size_t sent = 0u; sent < share;) {
+          std::size_t amount = std::min(batchSize, share - sent);
+          for (std::size_t i = 0u; i < amount; ++i) {
+            items[i] = sent + i;
+          }
+          std::size_t pushed = 0u;
+          while (pushed < amount) {
+            std::size_t count = queue.push_batch(items + pushed, items + amount);
+            if (count == 0u) {
+              std::this_thread::yield();
+            }
+            pushed += count;
+          }
+          sent += amount;
+        }
+      });
+    }
+    for (std::size_t c = 0u; c < consumersAmount; ++c) {
+      threads.emplace_back([&queue, &received, itemsAmount, batchSize]() {
+        std::size_t items[maxBatchSize];
+        while (received.load(std::memory_order_relaxed) < itemsAmount) {
+          std::size_t count = queue.pop_batch(items, batchSize);
+          if (count == 0u) {
+            std::this_thread::yield();
+            continue;
+          }
+          received.fetch_add(count, std::memory_order_relaxed);
+        }
+      });
+    }
+    for (std::thread& thread: threads) {
+      thread.join();
+    }
+
+    std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+    return itemsAmount / elapsed.count();
+  }
+}
+
+int main(int argc, const char *argv[])
+{
+  std::size_t itemsAmount = 10000000u;
+  std::size_t capacity = 4096u;
+  try {
+    if (argc > 1) {
+      itemsAmount = std::stoul(argv[1]);
+    }
+    if (argc > 2) {
+      capacity = std::stoul(argv[2]);
+    }
+  } catch (...) {
+    std::cerr << "Error: invalid arguments.";
+    return 1;
+  }
+
+  std::size_t maxThreads = std::max(2u, std::thread::hardware_concurrency());
+  const std::size_t batchSizes[] = {1u, 16u, maxBatchSize};
+
+  std::cout << "queue,producers,consumers,batch,items_per_second\n";
+  for (std::size_t batchSize: batchSizes) {
+    std::cout << "spsc,1,1," << batchSize << ',' << measureSpsc(itemsAmount, capacity, batchSize) << '\n';
+  }
+  for (std::size_t producers = 1u; producers <= maxThreads; producers *= 2) {
+    for (std::size_t consumers = 1u; consumers <= maxThreads; consumers *= 2) {
+      for (std::size_t batchSize: batchSizes) {
+        double throughput = measureMpmc(itemsAmount, capacity, batchSize, producers, consumers);
+        std::cout << "mpmc," << producers << ',' << consumers << ',' << batchSize << ',' << throughput << '\n';
+      }
+    }
+  }
+}
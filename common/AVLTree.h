@@ -5,8 +5,11 @@
 #include <iostream>
 
 #include "Stack.h"
+#include "StackBuffer.h"
 #include "Queue.h"
+#include "RingBuffer.h"
 #include "NodeFunctor.h"
+#include "output.h"
 
 namespace siobko {
   enum class TraversalStrategy {
@@ -50,7 +53,7 @@ namespace siobko {
     bool contains(const Key& key) const noexcept;
     bool is_empty() const noexcept;
     void remove(const Key& key, const Value& value);
-    void print() const noexcept;
+    void print() const;
 
   private:
     struct Node {
@@ -105,8 +108,8 @@ namespace siobko {
 
     Node *current_;
     TraversalStrategy strategy_ = TraversalStrategy::ASCENDING;
-    Stack< Node * > stack_;
-    Queue< Node * > queue_;
+    Stack< Node *, StackBuffer< Node *, 32 > > stack_;
+    Queue< Node *, RingBuffer< Node * > > queue_;
   };
 
   template< typename Key, typename Value, typename Compare >
@@ -214,8 +217,8 @@ namespace siobko {
 
     Node *current_;
     TraversalStrategy strategy_ = TraversalStrategy::ASCENDING;
-    Stack< Node * > stack_;
-    Queue< Node * > queue_;
+    Stack< Node *, StackBuffer< Node *, 32 > > stack_;
+    Queue< Node *, RingBuffer< Node * > > queue_;
   };
 
   template< typename Key, typename Value, typename Compare >
@@ -439,12 +442,14 @@ namespace siobko {
   }
 
   template< typename Key, typename Value, typename Compare >
-  void AVLTree< Key, Value, Compare >::print() const noexcept
+  void AVLTree< Key, Value, Compare >::print() const
   {
+    OutputWriter out(std::cout);
     for (auto& item: *this) {
-      std::cout << " " << item.first << " " << item.second;
+      out << ' ' << item.first << ' ' << item.second;
     }
-    std::cout << '\n';
+    out << '\n';
+    out.flush();
   }
 
   template< typename Key, typename Value, typename Compare >
@@ -584,7 +589,7 @@ namespace siobko {
   typename AVLTree< Key, Value, Compare >::Node *AVLTree< Key, Value, Compare >::rotate_right(Node *node)
   {
     Node *newNode = node->left_;
-    node->left_ = node->right_;
+    node->left_ = newNode->right_;
     newNode->right_ = node;
     fix_height(node);
     fix_height(newNode);
@@ -0,0 +1,42 @@
+#ifndef COMPARE_TRAITS_H
+#define COMPARE_TRAITS_H
+
+#include <functional>
+
+namespace siobko {
+  template< typename Ty, typename Compare >
+  struct CompareOrder {
+    static constexpr bool known = false;
+    static constexpr bool descending = false;
+  };
+
+  template< typename Ty >
+  struct CompareOrder< Ty, std::less< Ty > > {
+    static constexpr bool known = true;
+    static constexpr bool descending = false;
+  };
+
+  template< typename Ty >
+  struct CompareOrder< Ty, std::less<> > {
+    static constexpr bool known = true;
+    static constexpr bool descending = false;
+  };
+
+  template< typename Ty >
+  struct CompareOrder< Ty, std::greater< Ty > > {
+    static constexpr bool known = true;
+    static constexpr bool descending = true;
+  };
+
+  template< typename Ty >
+  struct CompareOrder< Ty, std::greater<> > {
+    static constexpr bool known = true;
+    static constexpr bool descending = true;
+  };
+
+  template< typename Compare >
+  struct CompareInstrumented {
+    static constexpr bool value = false;
+  };
+}
+#endif
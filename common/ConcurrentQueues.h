@@ -0,0 +1,325 @@
+#ifndef CONCURRENT_QUEUES_H
+#define CONCURRENT_QUEUES_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace siobko {
+  constexpr std::size_t cacheLineSize = 64;
+
+  template< class Ty >
+  class SpscQueue {
+  public:
+    using size_type = std::size_t;
+    using value_type = Ty;
+
+    explicit SpscQueue(size_type capacity);
+    SpscQueue(const SpscQueue& rhs) = delete;
+    ~SpscQueue();
+
+    SpscQueue& operator=(const SpscQueue& other) = delete;
+
+    bool try_push(const Ty& val);
+    bool try_pop(Ty& val);
+    template< typename InputIterator >
+    size_type push_batch(InputIterator first, InputIterator last);
+    template< typename OutputIterator >
+    size_type pop_batch(OutputIterator out, size_type maxAmount);
+    bool is_empty() const noexcept;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+
+  private:
+    Ty *slots_;
+    size_type mask_;
+
+    alignas(cacheLineSize) std::atomic< size_type > head_;
+    size_type cachedTail_;
+
+    alignas(cacheLineSize) std::atomic< size_type > tail_;
+    size_type cachedHead_;
+  };
+
+  template< class Ty >
+  class MpmcQueue {
+  public:
+    using size_type = std::size_t;
+    using value_type = Ty;
+
+    explicit MpmcQueue(size_type capacity);
+    MpmcQueue(const MpmcQueue& rhs) = delete;
+    ~MpmcQueue();
+
+    MpmcQueue& operator=(const MpmcQueue& other) = delete;
+
+    bool try_push(const Ty& val);
+    bool try_pop(Ty& val);
+    template< typename ForwardIterator >
+    size_type push_batch(ForwardIterator first, ForwardIterator last);
+    template< typename OutputIterator >
+    size_type pop_batch(OutputIterator out, size_type maxAmount);
+    size_type capacity() const noexcept;
+
+  private:
+    struct alignas(cacheLineSize) Cell {
+      std::atomic< size_type > sequence_;
+      alignas(Ty) unsigned char data_[sizeof(Ty)];
+    };
+
+    Ty *value(Cell& cell) noexcept;
+    size_type claim(std::atomic< size_type >& position, size_type maxAmount, size_type lag, size_type& start);
+
+    Cell *cells_;
+    size_type mask_;
+
+    alignas(cacheLineSize) std::atomic< size_type > enqueuePosition_;
+    alignas(cacheLineSize) std::atomic< size_type > dequeuePosition_;
+  };
+
+  namespace detail {
+    inline std::size_t roundUpToPowerOfTwo(std::size_t value)
+    {
+      std::size_t result = 1u;
+      while (result < value) {
+        result <<= 1;
+      }
+      return result;
+    }
+  }
+
+  template< class Ty >
+  SpscQueue< Ty >::SpscQueue(size_type capacity):
+    slots_(nullptr),
+    mask_(detail::roundUpToPowerOfTwo(capacity) - 1),
+    head_(0u),
+    cachedTail_(0u),
+    tail_(0u),
+    cachedHead_(0u)
+  {
+    if (capacity == 0u) {
+      throw std::logic_error("SpscQueue error: capacity must be positive.");
+    }
+    slots_ = static_cast< Ty * >(::operator new((mask_ + 1) * sizeof(Ty), std::align_val_t(alignof(Ty))));
+  }
+
+  template< class Ty >
+  SpscQueue< Ty >::~SpscQueue()
+  {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      slots_[i & mask_].~Ty();
+    }
+    ::operator delete(slots_, std::align_val_t(alignof(Ty)));
+  }
+
+  template< class Ty >
+  bool SpscQueue< Ty >::try_push(const Ty& val)
+  {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cachedHead_ > mask_) {
+      cachedHead_ = head_.load(std::memory_order_acquire);
+      if (tail - cachedHead_ > mask_) {
+        return false;
+      }
+    }
+    new (slots_ + (tail & mask_)) Ty(val);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  template< class Ty >
+  bool SpscQueue< Ty >::try_pop(Ty& val)
+  {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == cachedTail_) {
+      cachedTail_ = tail_.load(std::memory_order_acquire);
+      if (head == cachedTail_) {
+        return false;
+      }
+    }
+    Ty& slot = slots_[head & mask_];
+    val = std::move(slot);
+    slot.~Ty();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  template< class Ty >
+  template< typename InputIterator >
+  typename SpscQueue< Ty >::size_type SpscQueue< Ty >::push_batch(InputIterator first, InputIterator last)
+  {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type pushed = 0u;
+    while (first != last) {
+      if (tail + pushed - cachedHead_ > mask_) {
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        if (tail + pushed - cachedHead_ > mask_) {
+          break;
+        }
+      }
+      new (slots_ + ((tail + pushed) & mask_)) Ty(*first);
+      ++first;
+      ++pushed;
+    }
+    tail_.store(tail + pushed, std::memory_order_release);
+    return pushed;
+  }
+
+  template< class Ty >
+  template< typename OutputIterator >
+  typename SpscQueue< Ty >::size_type SpscQueue< Ty >::pop_batch(OutputIterator out, size_type maxAmount)
+  {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (cachedTail_ - head < maxAmount) {
+      cachedTail_ = tail_.load(std::memory_order_acquire);
+    }
+    size_type available = cachedTail_ - head;
+    size_type amount = (available < maxAmount) ? available : maxAmount;
+    for (size_type i = 0u; i < amount; ++i) {
+      Ty& slot = slots_[(head + i) & mask_];
+      *out = std::move(slot);
+      ++out;
+      slot.~Ty();
+    }
+    head_.store(head + amount, std::memory_order_release);
+    return amount;
+  }
+
+  template< class Ty >
+  bool SpscQueue< Ty >::is_empty() const noexcept
+  {
+    return size() == 0u;
+  }
+
+  template< class Ty >
+  typename SpscQueue< Ty >::size_type SpscQueue< Ty >::size() const noexcept
+  {
+    size_type head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+
+  template< class Ty >
+  typename SpscQueue< Ty >::size_type SpscQueue< Ty >::capacity() const noexcept
+  {
+    return mask_ + 1;
+  }
+
+  template< class Ty >
+  MpmcQueue< Ty >::MpmcQueue(size_type capacity):
+    cells_(nullptr),
+    mask_(detail::roundUpToPowerOfTwo(capacity) - 1),
+    enqueuePosition_(0u),
+    dequeuePosition_(0u)
+  {
+    if (capacity == 0u) {
+      throw std::logic_error("MpmcQueue error: capacity must be positive.");
+    }
+    cells_ = new Cell[mask_ + 1];
+    for (size_type i = 0u; i <= mask_; ++i) {
+      cells_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  template< class Ty >
+  MpmcQueue< Ty >::~MpmcQueue()
+  {
+    size_type last = enqueuePosition_.load(std::memory_order_relaxed);
+    for (size_type i = dequeuePosition_.load(std::memory_order_relaxed); i != last; ++i) {
+      value(cells_[i & mask_])->~Ty();
+    }
+    delete[] cells_;
+  }
+
+  template< class Ty >
+  bool MpmcQueue< Ty >::try_push(const Ty& val)
+  {
+    return push_batch(&val, &val + 1) == 1u;
+  }
+
+  template< class Ty >
+  bool MpmcQueue< Ty >::try_pop(Ty& val)
+  {
+    return pop_batch(&val, 1u) == 1u;
+  }
+
+  template< class Ty >
+  template< typename ForwardIterator >
+  typename MpmcQueue< Ty >::size_type MpmcQueue< Ty >::push_batch(ForwardIterator first, ForwardIterator last)
+  {
+    size_type wanted = 0u;
+    for (ForwardIterator it = first; it != last && wanted <= mask_; ++it) {
+      ++wanted;
+    }
+    size_type start = 0u;
+    size_type amount = claim(enqueuePosition_, wanted, 0u, start);
+    for (size_type i = 0u; i < amount; ++i, ++first) {
+      Cell& cell = cells_[(start + i) & mask_];
+      new (cell.data_) Ty(*first);
+      cell.sequence_.store(start + i + 1, std::memory_order_release);
+    }
+    return amount;
+  }
+
+  template< class Ty >
+  template< typename OutputIterator >
+  typename MpmcQueue< Ty >::size_type MpmcQueue< Ty >::pop_batch(OutputIterator out, size_type maxAmount)
+  {
+    size_type start = 0u;
+    size_type amount = claim(dequeuePosition_, maxAmount, 1u, start);
+    for (size_type i = 0u; i < amount; ++i) {
+      Cell& cell = cells_[(start + i) & mask_];
+      Ty *item = value(cell);
+      *out = std::move(*item);
+      ++out;
+      item->~Ty();
+      cell.sequence_.store(start + i + mask_ + 1, std::memory_order_release);
+    }
+    return amount;
+  }
+
+  template< class Ty >
+  typename MpmcQueue< Ty >::size_type MpmcQueue< Ty >::capacity() const noexcept
+  {
+    return mask_ + 1;
+  }
+
+  template< class Ty >
+  Ty *MpmcQueue< Ty >::value(Cell& cell) noexcept
+  {
+    return std::launder(reinterpret_cast< Ty * >(cell.data_));
+  }
+
+  template< class Ty >
+  typename MpmcQueue< Ty >::size_type MpmcQueue< Ty >::claim(std::atomic< size_type >& position, size_type maxAmount,
+      size_type lag, size_type& start)
+  {
+    size_type current = position.load(std::memory_order_relaxed);
+    while (maxAmount != 0u) {
+      size_type amount = 0u;
+      while (amount < maxAmount && amount <= mask_) {
+        size_type sequence = cells_[(current + amount) & mask_].sequence_.load(std::memory_order_acquire);
+        if (sequence != current + amount + lag) {
+          break;
+        }
+        ++amount;
+      }
+      if (amount == 0u) {
+        size_type sequence = cells_[current & mask_].sequence_.load(std::memory_order_acquire);
+        if (static_cast< std::ptrdiff_t >(sequence - (current + lag)) < 0) {
+          return 0u;
+        }
+        current = position.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (position.compare_exchange_weak(current, current + amount, std::memory_order_relaxed)) {
+        start = current;
+        return amount;
+      }
+    }
+    return 0u;
+  }
+}
+#endif
@@ -5,6 +5,7 @@
 #include <iostream>
 
 #include <ForwardList.h>
+#include <output.h>
 
 namespace siobko {
   template< typename Key, typename Value, typename Comparator = std::less< Key > >
@@ -39,7 +40,7 @@ namespace siobko {
     bool contains(const Key& k) const noexcept;
     bool is_empty() const noexcept;
     void merge(const Dictionary& dictionary);
-    void print();
+    void print() const;
     size_type size() const noexcept;
 
   private:
@@ -54,7 +55,7 @@ namespace siobko {
 
   template< typename Key, typename Value, typename Comparator >
   Dictionary< Key, Value, Comparator >::Dictionary(Dictionary&& rhs) noexcept:
-    storage_(rhs.storage_)
+    storage_(std::move(rhs.storage_))
   {}
 
   template< typename Key, typename Value, typename Comparator >
@@ -81,7 +82,7 @@ namespace siobko {
   Dictionary< Key, Value, Comparator >& Dictionary< Key, Value, Comparator >::operator=(Dictionary< Key, Value, Comparator >&& other) noexcept
   {
     if (this != &other) {
-      storage_ = other.storage_;
+      storage_ = std::move(other.storage_);
     }
     return *this;
   }
@@ -189,12 +190,14 @@ namespace siobko {
   }
 
   template< typename Key, typename Value, typename Comparator >
-  void Dictionary< Key, Value, Comparator >::print()
+  void Dictionary< Key, Value, Comparator >::print() const
   {
+    OutputWriter out(std::cout);
     for (const_iterator it = cbegin(); it != cend(); ++it) {
-      std::cout << " " << it->first << " " << it->second;
+      out << ' ' << it->first << ' ' << it->second;
     }
-    std::cout << "\n";
+    out << '\n';
+    out.flush();
   }
 
   template< typename Key, typename Value, typename Comparator >
@@ -0,0 +1,33 @@
+#include "ExternalSort.h"
+
+namespace siobko {
+  namespace detail {
+    void FileCloser::operator()(std::FILE *file) const noexcept
+    {
+      std::fclose(file);
+    }
+
+    file_ptr openFile(const std::string& name, const char *mode)
+    {
+      file_ptr file(std::fopen(name.c_str(), mode));
+      if (!file) {
+        throw std::runtime_error("External sort error: cannot open file " + name + ".");
+      }
+      return file;
+    }
+
+    file_ptr openTemporaryFile()
+    {
+      file_ptr file(std::tmpfile());
+      if (!file) {
+        throw std::runtime_error("External sort error: cannot create temporary file.");
+      }
+      return file;
+    }
+
+    std::size_t ioBufferSize(std::size_t memoryBudget)
+    {
+      return std::min(maxIoBufferBytes, std::max< std::size_t >(memoryBudget / 16, 4096u));
+    }
+  }
+}
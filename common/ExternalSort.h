@@ -0,0 +1,306 @@
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Sortings.h"
+#include "input.h"
+
+namespace siobko {
+  enum class FileFormat {
+    TEXT,
+    BINARY
+  };
+
+  struct ExternalSortOptions {
+    std::size_t memoryBudget = std::size_t(64) << 20;
+    FileFormat format = FileFormat::TEXT;
+  };
+
+  struct ExternalSortStats {
+    std::size_t elements = 0u;
+    std::size_t runs = 0u;
+    std::size_t mergePasses = 0u;
+  };
+
+  template< typename Ty, typename Compare >
+  ExternalSortStats externalSort(const std::string& input, const std::string& output, Compare cmp,
+      const ExternalSortOptions& options = ExternalSortOptions());
+
+  namespace detail {
+    constexpr std::size_t minRunBufferBytes = std::size_t(64) << 10;
+    constexpr std::size_t maxIoBufferBytes = std::size_t(1) << 20;
+    constexpr std::size_t maxMergeFanIn = 256;
+
+    struct FileCloser {
+      void operator()(std::FILE *file) const noexcept;
+    };
+
+    using file_ptr = std::unique_ptr< std::FILE, FileCloser >;
+
+    file_ptr openFile(const std::string& name, const char *mode);
+    file_ptr openTemporaryFile();
+    std::size_t ioBufferSize(std::size_t memoryBudget);
+
+    template< typename Ty >
+    class BinaryReader {
+    public:
+      BinaryReader(std::FILE *file, std::size_t bufferBytes);
+
+      bool next(Ty& value);
+
+    private:
+      std::FILE *file_;
+      std::vector< Ty > buffer_;
+      std::size_t position_;
+      std::size_t size_;
+    };
+
+    template< typename Ty >
+    class BinaryWriter {
+    public:
+      BinaryWriter(std::FILE *file, std::size_t bufferBytes);
+      ~BinaryWriter();
+
+      void put(const Ty& value);
+      void flush();
+
+    private:
+      std::FILE *file_;
+      std::vector< Ty > buffer_;
+      std::size_t size_;
+    };
+
+    template< typename Ty >
+    class TextWriter {
+    public:
+      TextWriter(std::FILE *file, std::size_t bufferBytes);
+      ~TextWriter();
+
+      void put(const Ty& value);
+      void flush();
+
+    private:
+      static constexpr std::size_t maxValueLength = 64;
+
+      std::FILE *file_;
+      std::vector< char > buffer_;
+      std::size_t size_;
+    };
+
+    template< typename Ty >
+    BinaryReader< Ty >::BinaryReader(std::FILE *file, std::size_t bufferBytes):
+      file_(file),
+      buffer_(std::max< std::size_t >(1u, bufferBytes / sizeof(Ty))),
+      position_(0u),
+      size_(0u)
+    {}
+
+    template< typename Ty >
+    bool BinaryReader< Ty >::next(Ty& value)
+    {
+      if (position_ == size_) {
+        std::size_t bytes = std::fread(buffer_.data(), 1u, buffer_.size() * sizeof(Ty), file_);
+        if (std::ferror(file_)) {
+          throw std::runtime_error("External sort error: cannot read file.");
+        }
+        if (bytes % sizeof(Ty) != 0u) {
+          throw std::runtime_error("External sort error: binary input ends with a partial element.");
+        }
+        size_ = bytes / sizeof(Ty);
+        position_ = 0u;
+        if (size_ == 0u) {
+          return false;
+        }
+      }
+      value = buffer_[position_++];
+      return true;
+    }
+
+    template< typename Ty >
+    BinaryWriter< Ty >::BinaryWriter(std::FILE *file, std::size_t bufferBytes):
+      file_(file),
+      buffer_(std::max< std::size_t >(1u, bufferBytes / sizeof(Ty))),
+      size_(0u)
+    {}
+
+    template< typename Ty >
+    BinaryWriter< Ty >::~BinaryWriter()
+    {
+      try {
+        flush();
+      } catch (...) {
+      }
+    }
+
+    template< typename Ty >
+    void BinaryWriter< Ty >::put(const Ty& value)
+    {
+      if (size_ == buffer_.size()) {
+        flush();
+      }
+      buffer_[size_++] = value;
+    }
+
+    template< typename Ty >
+    void BinaryWriter< Ty >::flush()
+    {
+      if (std::fwrite(buffer_.data(), sizeof(Ty), size_, file_) != size_) {
+        throw std::runtime_error("External sort error: cannot write file.");
+      }
+      size_ = 0u;
+    }
+
+    template< typename Ty >
+    TextWriter< Ty >::TextWriter(std::FILE *file, std::size_t bufferBytes):
+      file_(file),
+      buffer_(std::max(2 * maxValueLength, bufferBytes)),
+      size_(0u)
+    {}
+
+    template< typename Ty >
+    TextWriter< Ty >::~TextWriter()
+    {
+      try {
+        flush();
+      } catch (...) {
+      }
+    }
+
+    template< typename Ty >
+    void TextWriter< Ty >::put(const Ty& value)
+    {
+      if (buffer_.size() - size_ < maxValueLength) {
+        flush();
+      }
+      char *first = buffer_.data() + size_;
+      auto result = std::to_chars(first, buffer_.data() + buffer_.size() - 1, value);
+      *result.ptr = '\n';
+      size_ += result.ptr - first + 1;
+    }
+
+    template< typename Ty >
+    void TextWriter< Ty >::flush()
+    {
+      if (std::fwrite(buffer_.data(), 1u, size_, file_) != size_) {
+        throw std::runtime_error("External sort error: cannot write file.");
+      }
+      size_ = 0u;
+    }
+
+    template< typename Ty, typename Reader, typename Compare >
+    std::vector< file_ptr > generateRuns(Reader& reader, std::size_t capacity, std::size_t bufferBytes, Compare cmp,
+        ExternalSortStats& stats)
+    {
+      std::vector< file_ptr > runs;
+      std::vector< Ty > chunk;
+      chunk.reserve(capacity);
+      Ty value{};
+      bool more = reader.next(value);
+      while (more) {
+        chunk.clear();
+        do {
+          chunk.push_back(value);
+          more = reader.next(value);
+        } while (more && chunk.size() < capacity);
+        stats.elements += chunk.size();
+
+        siobko::quickSort(chunk.begin(), chunk.end(), cmp);
+        runs.push_back(openTemporaryFile());
+        BinaryWriter< Ty > writer(runs.back().get(), bufferBytes);
+        for (const Ty& item: chunk) {
+          writer.put(item);
+        }
+        writer.flush();
+      }
+      return runs;
+    }
+
+    template< typename Ty, typename Writer, typename Compare >
+    void mergeRuns(std::vector< file_ptr >::iterator first, std::vector< file_ptr >::iterator last, Writer& writer,
+        std::size_t bufferBytes, Compare cmp)
+    {
+      std::vector< BinaryReader< Ty > > readers;
+      readers.reserve(last - first);
+      for (auto it = first; it != last; ++it) {
+        std::rewind(it->get());
+        readers.emplace_back(it->get(), bufferBytes);
+      }
+      loserTreeMerge< Ty >(readers, [&writer](const Ty& value) {
+        writer.put(value);
+      }, cmp);
+      writer.flush();
+    }
+
+    template< typename Ty, typename Writer, typename Compare >
+    void mergeAllRuns(std::vector< file_ptr > runs, Writer& writer, std::size_t budget, Compare cmp,
+        ExternalSortStats& stats)
+    {
+      if (runs.empty()) {
+        return;
+      }
+      std::size_t fanIn = std::max< std::size_t >(2u, std::min(maxMergeFanIn, budget / minRunBufferBytes));
+      while (runs.size() > fanIn) {
+        std::vector< file_ptr > merged;
+        std::size_t bufferBytes = budget / (fanIn + 1);
+        for (auto first = runs.begin(); first != runs.end();) {
+          auto last = first + std::min< std::ptrdiff_t >(fanIn, runs.end() - first);
+          merged.push_back(openTemporaryFile());
+          BinaryWriter< Ty > runWriter(merged.back().get(), bufferBytes);
+          mergeRuns< Ty >(first, last, runWriter, bufferBytes, cmp);
+          first = last;
+        }
+        runs = std::move(merged);
+        ++stats.mergePasses;
+      }
+      mergeRuns< Ty >(runs.begin(), runs.end(), writer, budget / (runs.size() + 1), cmp);
+      ++stats.mergePasses;
+    }
+
+    template< typename Ty, typename Reader, typename Compare >
+    ExternalSortStats externalSort(Reader& reader, const std::string& output, Compare cmp,
+        const ExternalSortOptions& options)
+    {
+      ExternalSortStats stats;
+      std::size_t ioBufferBytes = ioBufferSize(options.memoryBudget);
+      std::size_t chunkBytes = options.memoryBudget > 3 * ioBufferBytes ? options.memoryBudget - 3 * ioBufferBytes : 0u;
+      std::size_t capacity = std::max< std::size_t >(1024u, chunkBytes / sizeof(Ty));
+
+      std::vector< file_ptr > runs = generateRuns< Ty >(reader, capacity, ioBufferBytes, cmp, stats);
+      stats.runs = runs.size();
+      file_ptr out = openFile(output, options.format == FileFormat::TEXT ? "w" : "wb");
+      if (options.format == FileFormat::TEXT) {
+        TextWriter< Ty > writer(out.get(), ioBufferBytes);
+        mergeAllRuns< Ty >(std::move(runs), writer, options.memoryBudget, cmp, stats);
+      } else {
+        BinaryWriter< Ty > writer(out.get(), ioBufferBytes);
+        mergeAllRuns< Ty >(std::move(runs), writer, options.memoryBudget, cmp, stats);
+      }
+      return stats;
+    }
+  }
+
+  template< typename Ty, typename Compare >
+  ExternalSortStats externalSort(const std::string& input, const std::string& output, Compare cmp,
+      const ExternalSortOptions& options)
+  {
+    static_assert(std::is_arithmetic< Ty >::value, "externalSort supports arithmetic types only.");
+
+    detail::file_ptr in = detail::openFile(input, options.format == FileFormat::TEXT ? "r" : "rb");
+    std::size_t ioBufferBytes = detail::ioBufferSize(options.memoryBudget);
+    if (options.format == FileFormat::TEXT) {
+      NumberScanner reader(in.get(), ioBufferBytes);
+      return detail::externalSort< Ty >(reader, output, cmp, options);
+    }
+    detail::BinaryReader< Ty > reader(in.get(), ioBufferBytes);
+    return detail::externalSort< Ty >(reader, output, cmp, options);
+  }
+}
+#endif
@@ -3,8 +3,12 @@
 #define FORWARD_LIST_H
 
 #include <stdexcept>
+#include <cstddef>
 #include <utility>
 #include <cassert>
+#include <new>
+#include <functional>
+#include <iterator>
 
 namespace siobko {
   template< class Ty >
@@ -41,11 +45,18 @@ namespace siobko {
     const_reference front() const noexcept;
 
     void insert_after(const Ty& val, iterator where);
+    void splice_after(iterator where, ForwardList& other);
+    void push_back(const Ty& val);
     void push_front(const Ty& val);
     void emplace_front(const Ty& val);
     void pop_front();
     bool is_empty() const noexcept;
     void clear() noexcept;
+    void reserve(size_type capacity);
+    template< typename Compare = std::less< Ty > >
+    void merge(ForwardList& other, Compare cmp = Compare());
+    template< typename Compare = std::less< Ty > >
+    void sort(Compare cmp = Compare());
     size_type size() const noexcept;
 
   private:
@@ -60,16 +71,32 @@ namespace siobko {
       Node *next_;
     };
 
-    void push_back(const Ty& val);
+    struct FreeNode {
+      FreeNode *next_;
+    };
+
+    static constexpr size_type defaultFreeCapacity = 32;
+
+    Node *create_node(const Ty& val, Node *next);
+    void destroy_node(Node *node) noexcept;
+    void release_free_nodes() noexcept;
 
     Node *head_;
+    Node *tail_;
     std::size_t size_;
+    FreeNode *free_;
+    size_type freeSize_;
+    size_type freeCapacity_;
   };
 
 
   template< class Ty >
   class ForwardList< Ty >::ConstIterator {
   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Ty&;
     using const_reference = const Ty&;
     using pointer = const Ty *;
 
@@ -134,6 +161,9 @@ namespace siobko {
   template< class Ty >
   class ForwardList< Ty >::Iterator {
   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
     using reference = Ty&;
     using pointer = Ty *;
 
@@ -198,13 +228,21 @@ namespace siobko {
   template< class Ty >
   ForwardList< Ty >::ForwardList():
     head_(nullptr),
-    size_(0u)
+    tail_(nullptr),
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {}
 
   template< class Ty >
   ForwardList< Ty >::ForwardList(const ForwardList< Ty >& rhs):
     head_(nullptr),
-    size_(0u)
+    tail_(nullptr),
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {
     for (auto item: rhs) {
       push_back(item);
@@ -214,19 +252,31 @@ namespace siobko {
   template< class Ty >
   ForwardList< Ty >::ForwardList(ForwardList< Ty >&& rhs) noexcept:
     head_(nullptr),
-    size_(0u)
+    tail_(nullptr),
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {
     std::swap(rhs.head_, head_);
+    std::swap(rhs.tail_, tail_);
     std::swap(rhs.size_, size_);
+    std::swap(rhs.free_, free_);
+    std::swap(rhs.freeSize_, freeSize_);
+    std::swap(rhs.freeCapacity_, freeCapacity_);
   }
 
   template< class Ty >
   ForwardList< Ty >::ForwardList(std::initializer_list< value_type > IList):
     head_(nullptr),
-    size_(0u)
+    tail_(nullptr),
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {
     for (auto item: IList) {
-      pushFront(item);
+      push_back(item);
     }
   }
 
@@ -234,6 +284,7 @@ namespace siobko {
   ForwardList< Ty >::~ForwardList()
   {
     clear();
+    release_free_nodes();
   }
 
   template< class Ty >
@@ -250,7 +301,11 @@ namespace siobko {
   {
     if (this != &other) {
       std::swap(head_, other.head_);
+      std::swap(tail_, other.tail_);
       std::swap(size_, other.size_);
+      std::swap(free_, other.free_);
+      std::swap(freeSize_, other.freeSize_);
+      std::swap(freeCapacity_, other.freeCapacity_);
     }
     return *this;
   }
@@ -306,33 +361,51 @@ namespace siobko {
   template< class Ty >
   void ForwardList< Ty >::insert_after(const Ty& val, ForwardList::iterator where)
   {
-    iterator it = begin();
+    if (where.current_ == nullptr) {
+      throw std::logic_error("ForwardList insert error: cannot insert after end.");
+    }
+    Node *newNode = create_node(val, where.current_->next_);
+    where.current_->next_ = newNode;
+    if (where.current_ == tail_) {
+      tail_ = newNode;
+    }
     size_++;
+  }
 
-    while (it != end() || it == where) {
-      if (it == where) {
-        Node *newNode = new Node(val);
-        newNode->next_ = where.current_->next_;
-        where.current_->next_ = newNode;
-        return;
-      }
-      ++it;
+  template< class Ty >
+  void ForwardList< Ty >::splice_after(ForwardList::iterator where, ForwardList& other)
+  {
+    if (this == &other || other.is_empty()) {
+      return;
     }
-
-    throw std::logic_error("ForwardList insert error: cannot find iterator.");
+    if (where.current_ == nullptr) {
+      throw std::logic_error("ForwardList splice error: cannot splice after end.");
+    }
+    other.tail_->next_ = where.current_->next_;
+    where.current_->next_ = other.head_;
+    if (where.current_ == tail_) {
+      tail_ = other.tail_;
+    }
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0u;
   }
 
   template< class Ty >
   void ForwardList< Ty >::push_front(const Ty& val)
   {
-    head_ = new Node(val, head_);
+    head_ = create_node(val, head_);
+    if (tail_ == nullptr) {
+      tail_ = head_;
+    }
     size_++;
   }
 
   template< class Ty >
   void ForwardList< Ty >::emplace_front(const Ty& val)
   {
-    head_ = new Node(std::forward< Ty >(val), head_);
+    push_front(val);
   }
 
   template< class Ty >
@@ -342,8 +415,11 @@ namespace siobko {
       throw std::logic_error("pop front error: ForwardList is empty.");
     }
     Node *tmp = head_->next_;
-    delete head_;
+    destroy_node(head_);
     head_ = tmp;
+    if (head_ == nullptr) {
+      tail_ = nullptr;
+    }
     --size_;
   }
 
@@ -361,6 +437,105 @@ namespace siobko {
     }
   }
 
+  template< class Ty >
+  void ForwardList< Ty >::reserve(size_type capacity)
+  {
+    if (capacity > freeCapacity_) {
+      freeCapacity_ = capacity;
+    }
+    while (size_ + freeSize_ < capacity) {
+      free_ = new (::operator new(sizeof(Node))) FreeNode{free_};
+      ++freeSize_;
+    }
+  }
+
+  template< class Ty >
+  template< typename Compare >
+  void ForwardList< Ty >::merge(ForwardList& other, Compare cmp)
+  {
+    if (this == &other || other.is_empty()) {
+      return;
+    }
+    Node *left = head_;
+    Node *right = other.head_;
+    Node *last = nullptr;
+    while (left != nullptr || right != nullptr) {
+      Node *next = nullptr;
+      if (right == nullptr || (left != nullptr && !cmp(right->value_, left->value_))) {
+        next = left;
+        left = left->next_;
+      } else {
+        next = right;
+        right = right->next_;
+      }
+      if (last == nullptr) {
+        head_ = next;
+      } else {
+        last->next_ = next;
+      }
+      last = next;
+    }
+    last->next_ = nullptr;
+    tail_ = last;
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0u;
+  }
+
+  template< class Ty >
+  template< typename Compare >
+  void ForwardList< Ty >::sort(Compare cmp)
+  {
+    if (size_ < 2) {
+      return;
+    }
+    for (size_type width = 1u;; width *= 2) {
+      Node *left = head_;
+      Node *last = nullptr;
+      size_type merges = 0u;
+      head_ = nullptr;
+      while (left != nullptr) {
+        ++merges;
+        Node *right = left;
+        size_type leftSize = 0u;
+        while (leftSize < width && right != nullptr) {
+          ++leftSize;
+          right = right->next_;
+        }
+        size_type rightSize = width;
+        while (leftSize > 0u || (rightSize > 0u && right != nullptr)) {
+          Node *next = nullptr;
+          if (leftSize == 0u) {
+            next = right;
+            right = right->next_;
+            --rightSize;
+          } else if (rightSize == 0u || right == nullptr || !cmp(right->value_, left->value_)) {
+            next = left;
+            left = left->next_;
+            --leftSize;
+          } else {
+            next = right;
+            right = right->next_;
+            --rightSize;
+          }
+          if (last == nullptr) {
+            head_ = next;
+          } else {
+            last->next_ = next;
+          }
+          last = next;
+        }
+        left = right;
+      }
+      last->next_ = nullptr;
+      tail_ = last;
+      if (merges <= 1u) {
+        break;
+      }
+    }
+  }
+
   template< class Ty >
   typename ForwardList< Ty >::size_type ForwardList< Ty >::size() const noexcept
   {
@@ -370,16 +545,57 @@ namespace siobko {
   template< class Ty >
   void ForwardList< Ty >::push_back(const Ty& val)
   {
+    Node *newNode = create_node(val, nullptr);
+    if (tail_ == nullptr) {
+      head_ = newNode;
+    } else {
+      tail_->next_ = newNode;
+    }
+    tail_ = newNode;
     size_++;
-    if (head_ == nullptr) {
-      head_ = new Node(val);
-      return;
+  }
+
+  template< class Ty >
+  typename ForwardList< Ty >::Node *ForwardList< Ty >::create_node(const Ty& val, Node *next)
+  {
+    void *memory = nullptr;
+    if (free_ != nullptr) {
+      memory = free_;
+      free_ = free_->next_;
+      --freeSize_;
+    } else {
+      memory = ::operator new(sizeof(Node));
     }
-    Node *current = this->head_;
-    while (current->next_ != nullptr) {
-      current = current->next_;
+    try {
+      return new (memory) Node(val, next);
+    } catch (...) {
+      free_ = new (memory) FreeNode{free_};
+      ++freeSize_;
+      throw;
+    }
+  }
+
+  template< class Ty >
+  void ForwardList< Ty >::destroy_node(Node *node) noexcept
+  {
+    node->~Node();
+    if (freeSize_ < freeCapacity_) {
+      free_ = new (node) FreeNode{free_};
+      ++freeSize_;
+    } else {
+      ::operator delete(node);
+    }
+  }
+
+  template< class Ty >
+  void ForwardList< Ty >::release_free_nodes() noexcept
+  {
+    while (free_ != nullptr) {
+      FreeNode *next = free_->next_;
+      ::operator delete(free_);
+      free_ = next;
     }
-    current->next_ = new Node(val);
+    freeSize_ = 0u;
   }
 }
 #endif
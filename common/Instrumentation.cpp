@@ -0,0 +1,17 @@
+#include "Instrumentation.h"
+
+namespace siobko {
+  void OperationCounters::reset() noexcept
+  {
+    comparisons.store(0u, std::memory_order_relaxed);
+    copies.store(0u, std::memory_order_relaxed);
+    moves.store(0u, std::memory_order_relaxed);
+    swaps.store(0u, std::memory_order_relaxed);
+  }
+
+  OperationCounters& operationCounters()
+  {
+    static OperationCounters counters;
+    return counters;
+  }
+}
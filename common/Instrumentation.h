@@ -0,0 +1,190 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "CompareTraits.h"
+
+namespace siobko {
+  struct OperationCounters {
+    void reset() noexcept;
+
+    std::atomic< std::uint64_t > comparisons{0u};
+    std::atomic< std::uint64_t > copies{0u};
+    std::atomic< std::uint64_t > moves{0u};
+    std::atomic< std::uint64_t > swaps{0u};
+  };
+
+  OperationCounters& operationCounters();
+
+  template< typename Compare, bool Enabled = true >
+  class CountingCompare {
+  public:
+    CountingCompare();
+    explicit CountingCompare(Compare cmp, OperationCounters& counters = operationCounters());
+
+    template< typename Lhs, typename Rhs >
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const;
+
+    const Compare& base() const noexcept;
+    OperationCounters& counters() const noexcept;
+
+  private:
+    Compare cmp_;
+    OperationCounters *counters_;
+  };
+
+  template< typename Compare >
+  class CountingCompare< Compare, false > {
+  public:
+    CountingCompare() = default;
+    explicit CountingCompare(Compare cmp, OperationCounters& = operationCounters()):
+      cmp_(cmp)
+    {}
+
+    template< typename Lhs, typename Rhs >
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    {
+      return cmp_(lhs, rhs);
+    }
+
+    const Compare& base() const noexcept
+    {
+      return cmp_;
+    }
+
+  private:
+    Compare cmp_;
+  };
+
+  template< typename Ty >
+  struct Counted {
+    Counted();
+    Counted(const Ty& item);
+    Counted(const Counted& other);
+    Counted(Counted&& other) noexcept;
+    ~Counted() = default;
+
+    Counted& operator=(const Counted& other);
+    Counted& operator=(Counted&& other) noexcept;
+
+    Ty value;
+  };
+
+  struct CountedValue {
+    template< typename Ty >
+    const Ty& operator()(const Counted< Ty >& item) const noexcept
+    {
+      return item.value;
+    }
+  };
+
+  template< typename Ty, typename Compare, bool Enabled >
+  struct CompareOrder< Ty, CountingCompare< Compare, Enabled > >: CompareOrder< Ty, Compare > {};
+
+  template< typename Compare >
+  struct CompareInstrumented< CountingCompare< Compare, true > > {
+    static constexpr bool value = true;
+  };
+
+  template< typename Compare, bool Enabled >
+  CountingCompare< Compare, Enabled >::CountingCompare():
+    cmp_(),
+    counters_(&operationCounters())
+  {}
+
+  template< typename Compare, bool Enabled >
+  CountingCompare< Compare, Enabled >::CountingCompare(Compare cmp, OperationCounters& counters):
+    cmp_(cmp),
+    counters_(&counters)
+  {}
+
+  template< typename Compare, bool Enabled >
+  template< typename Lhs, typename Rhs >
+  bool CountingCompare< Compare, Enabled >::operator()(const Lhs& lhs, const Rhs& rhs) const
+  {
+    counters_->comparisons.fetch_add(1u, std::memory_order_relaxed);
+    return cmp_(lhs, rhs);
+  }
+
+  template< typename Compare, bool Enabled >
+  const Compare& CountingCompare< Compare, Enabled >::base() const noexcept
+  {
+    return cmp_;
+  }
+
+  template< typename Compare, bool Enabled >
+  OperationCounters& CountingCompare< Compare, Enabled >::counters() const noexcept
+  {
+    return *counters_;
+  }
+
+  template< typename Ty >
+  Counted< Ty >::Counted():
+    value()
+  {}
+
+  template< typename Ty >
+  Counted< Ty >::Counted(const Ty& item):
+    value(item)
+  {}
+
+  template< typename Ty >
+  Counted< Ty >::Counted(const Counted& other):
+    value(other.value)
+  {
+    operationCounters().copies.fetch_add(1u, std::memory_order_relaxed);
+  }
+
+  template< typename Ty >
+  Counted< Ty >::Counted(Counted&& other) noexcept:
+    value(std::move(other.value))
+  {
+    operationCounters().moves.fetch_add(1u, std::memory_order_relaxed);
+  }
+
+  template< typename Ty >
+  Counted< Ty >& Counted< Ty >::operator=(const Counted& other)
+  {
+    value = other.value;
+    operationCounters().copies.fetch_add(1u, std::memory_order_relaxed);
+    return *this;
+  }
+
+  template< typename Ty >
+  Counted< Ty >& Counted< Ty >::operator=(Counted&& other) noexcept
+  {
+    value = std::move(other.value);
+    operationCounters().moves.fetch_add(1u, std::memory_order_relaxed);
+    return *this;
+  }
+
+  template< typename Ty >
+  void swap(Counted< Ty >& lhs, Counted< Ty >& rhs) noexcept
+  {
+    using std::swap;
+    swap(lhs.value, rhs.value);
+    operationCounters().swaps.fetch_add(1u, std::memory_order_relaxed);
+  }
+
+  template< typename Ty >
+  bool operator<(const Counted< Ty >& lhs, const Counted< Ty >& rhs)
+  {
+    return lhs.value < rhs.value;
+  }
+
+  template< typename Ty >
+  bool operator>(const Counted< Ty >& lhs, const Counted< Ty >& rhs)
+  {
+    return rhs.value < lhs.value;
+  }
+
+  template< typename Ty >
+  bool operator==(const Counted< Ty >& lhs, const Counted< Ty >& rhs)
+  {
+    return lhs.value == rhs.value;
+  }
+}
+#endif
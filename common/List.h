@@ -6,6 +6,9 @@
 #include <cstddef>
 #include <utility>
 #include <cassert>
+#include <new>
+#include <functional>
+#include <iterator>
 
 namespace siobko {
   template< class Ty >
@@ -52,6 +55,12 @@ namespace siobko {
     void pop_front();
     bool is_empty() const noexcept;
     void clear() noexcept;
+    void reserve(size_type capacity);
+    void splice(const_iterator where, List& other);
+    template< typename Compare = std::less< Ty > >
+    void merge(List& other, Compare cmp = Compare());
+    template< typename Compare = std::less< Ty > >
+    void sort(Compare cmp = Compare());
     size_type size() const noexcept;
 
   private:
@@ -68,13 +77,31 @@ namespace siobko {
       Node *prev_;
     };
 
+    struct FreeNode {
+      FreeNode *next_;
+    };
+
+    static constexpr size_type defaultFreeCapacity = 32;
+
+    Node *create_node(const Ty& val, Node *next, Node *prev);
+    void destroy_node(Node *node) noexcept;
+    void release_free_nodes() noexcept;
+    void relink_backward() noexcept;
+
     Node *head_;
     Node *tail_;
     size_t size_;
+    FreeNode *free_;
+    size_type freeSize_;
+    size_type freeCapacity_;
   };
 
   template< class Ty >
   struct List< Ty >::ConstIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Ty&;
     using const_reference = const Ty&;
     using pointer = const Ty *;
 
@@ -155,6 +182,9 @@ namespace siobko {
 
   template< class Ty >
   struct List< Ty >::Iterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
     using reference = Ty&;
     using pointer = Ty *;
 
@@ -237,14 +267,20 @@ namespace siobko {
   List< Ty >::List():
     head_(nullptr),
     tail_(nullptr),
-    size_(0u)
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {}
 
   template< class Ty >
   List< Ty >::List(const List< Ty >& rhs):
     head_(nullptr),
     tail_(nullptr),
-    size_(0u)
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {
     for (auto item: rhs) {
       push_back(item);
@@ -255,18 +291,27 @@ namespace siobko {
   List< Ty >::List(List< Ty >&& rhs) noexcept:
     head_(nullptr),
     tail_(nullptr),
-    size_(0u)
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {
     std::swap(rhs.head_, head_);
     std::swap(rhs.tail_, tail_);
     std::swap(rhs.size_, size_);
+    std::swap(rhs.free_, free_);
+    std::swap(rhs.freeSize_, freeSize_);
+    std::swap(rhs.freeCapacity_, freeCapacity_);
   }
 
   template< class Ty >
   List< Ty >::List(std::initializer_list< value_type > IList):
     head_(nullptr),
     tail_(nullptr),
-    size_(0u)
+    size_(0u),
+    free_(nullptr),
+    freeSize_(0u),
+    freeCapacity_(defaultFreeCapacity)
   {
     for (auto item: IList) {
       push_back(item);
@@ -277,12 +322,13 @@ namespace siobko {
   List< Ty >::~List()
   {
     clear();
+    release_free_nodes();
   }
 
   template< class Ty >
   List< Ty >& List< Ty >::operator=(const List& other)
   {
-    if (this != other) {
+    if (this != &other) {
       (*this) = List< Ty >(other);
     }
     return *this;
@@ -295,6 +341,9 @@ namespace siobko {
       std::swap(head_, other.head_);
       std::swap(tail_, other.tail_);
       std::swap(size_, other.size_);
+      std::swap(free_, other.free_);
+      std::swap(freeSize_, other.freeSize_);
+      std::swap(freeCapacity_, other.freeCapacity_);
     }
     return *this;
   }
@@ -362,11 +411,15 @@ namespace siobko {
   template< class Ty >
   void List< Ty >::insert(const Ty& val, const_iterator where)
   {
-    if (where == head_) {
+    if (where.current_ == nullptr) {
+      push_back(val);
+      return;
+    }
+    if (where.current_ == head_) {
       push_front(val);
       return;
     }
-    Node *newNode = new Node(val, where.current_, where.current_->prev_);
+    Node *newNode = create_node(val, where.current_, where.current_->prev_);
     where.current_->prev_->next_ = newNode;
     where.current_->prev_ = newNode;
     size_++;
@@ -375,7 +428,7 @@ namespace siobko {
   template< class Ty >
   void List< Ty >::push_back(const Ty& val)
   {
-    Node *newNode = new Node(val, nullptr, tail_);
+    Node *newNode = create_node(val, nullptr, tail_);
     if (is_empty()) {
       tail_ = newNode;
       head_ = newNode;
@@ -389,7 +442,7 @@ namespace siobko {
   template< class Ty >
   void List< Ty >::push_front(const Ty& val)
   {
-    Node *newNode = new Node(val, head_, nullptr);
+    Node *newNode = create_node(val, head_, nullptr);
     if (is_empty()) {
       head_ = newNode;
       tail_ = newNode;
@@ -403,29 +456,13 @@ namespace siobko {
   template< class Ty >
   void List< Ty >::emplace_back(const Ty& val)
   {
-    Node *newNode = new Node(std::forward< Ty >(val));
-    size_++;
-    if (is_empty()) {
-      head_ = newNode;
-      tail_ = newNode;
-      return;
-    }
-    newNode->prev_ = tail_;
-    tail_ = newNode;
+    push_back(val);
   }
 
   template< class Ty >
   void List< Ty >::emplace_front(const Ty& val)
   {
-    Node *newNode = new Node(std::forward< Ty >(val));
-    size_++;
-    if (is_empty()) {
-      head_ = newNode;
-      tail_ = newNode;
-      return;
-    }
-    newNode->next_ = head_;
-    head_ = newNode;
+    push_front(val);
   }
 
   template< class Ty >
@@ -436,12 +473,12 @@ namespace siobko {
     }
 
     if (size_ == 1) {
-      delete head_;
+      destroy_node(head_);
       head_ = nullptr;
       tail_ = nullptr;
     } else {
       head_ = head_->next_;
-      delete head_->prev_;
+      destroy_node(head_->prev_);
       head_->prev_ = nullptr;
     }
     size_--;
@@ -455,12 +492,12 @@ namespace siobko {
     }
 
     if (size_ == 1) {
-      delete tail_;
+      destroy_node(tail_);
       head_ = nullptr;
       tail_ = nullptr;
     } else {
       tail_ = tail_->prev_;
-      delete tail_->next_;
+      destroy_node(tail_->next_);
       tail_->next_ = nullptr;
     }
     size_--;
@@ -480,10 +517,189 @@ namespace siobko {
     }
   }
 
+  template< class Ty >
+  void List< Ty >::reserve(size_type capacity)
+  {
+    if (capacity > freeCapacity_) {
+      freeCapacity_ = capacity;
+    }
+    while (size_ + freeSize_ < capacity) {
+      free_ = new (::operator new(sizeof(Node))) FreeNode{free_};
+      ++freeSize_;
+    }
+  }
+
+  template< class Ty >
+  void List< Ty >::splice(const_iterator where, List& other)
+  {
+    if (this == &other || other.is_empty()) {
+      return;
+    }
+    Node *next = where.current_;
+    Node *prev = (next == nullptr) ? tail_ : next->prev_;
+    other.head_->prev_ = prev;
+    other.tail_->next_ = next;
+    if (prev == nullptr) {
+      head_ = other.head_;
+    } else {
+      prev->next_ = other.head_;
+    }
+    if (next == nullptr) {
+      tail_ = other.tail_;
+    } else {
+      next->prev_ = other.tail_;
+    }
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0u;
+  }
+
+  template< class Ty >
+  template< typename Compare >
+  void List< Ty >::merge(List& other, Compare cmp)
+  {
+    if (this == &other || other.is_empty()) {
+      return;
+    }
+    Node *left = head_;
+    Node *right = other.head_;
+    Node *last = nullptr;
+    while (left != nullptr || right != nullptr) {
+      Node *next = nullptr;
+      if (right == nullptr || (left != nullptr && !cmp(right->data_, left->data_))) {
+        next = left;
+        left = left->next_;
+      } else {
+        next = right;
+        right = right->next_;
+      }
+      if (last == nullptr) {
+        head_ = next;
+      } else {
+        last->next_ = next;
+      }
+      last = next;
+    }
+    last->next_ = nullptr;
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0u;
+    relink_backward();
+  }
+
+  template< class Ty >
+  template< typename Compare >
+  void List< Ty >::sort(Compare cmp)
+  {
+    if (size_ < 2) {
+      return;
+    }
+    for (size_type width = 1u;; width *= 2) {
+      Node *left = head_;
+      Node *last = nullptr;
+      size_type merges = 0u;
+      head_ = nullptr;
+      while (left != nullptr) {
+        ++merges;
+        Node *right = left;
+        size_type leftSize = 0u;
+        while (leftSize < width && right != nullptr) {
+          ++leftSize;
+          right = right->next_;
+        }
+        size_type rightSize = width;
+        while (leftSize > 0u || (rightSize > 0u && right != nullptr)) {
+          Node *next = nullptr;
+          if (leftSize == 0u) {
+            next = right;
+            right = right->next_;
+            --rightSize;
+          } else if (rightSize == 0u || right == nullptr || !cmp(right->data_, left->data_)) {
+            next = left;
+            left = left->next_;
+            --leftSize;
+          } else {
+            next = right;
+            right = right->next_;
+            --rightSize;
+          }
+          if (last == nullptr) {
+            head_ = next;
+          } else {
+            last->next_ = next;
+          }
+          last = next;
+        }
+        left = right;
+      }
+      last->next_ = nullptr;
+      if (merges <= 1u) {
+        break;
+      }
+    }
+    relink_backward();
+  }
+
   template< class Ty >
   typename List< Ty >::size_type List< Ty >::size() const noexcept
   {
     return size_;
   }
+
+  template< class Ty >
+  typename List< Ty >::Node *List< Ty >::create_node(const Ty& val, Node *next, Node *prev)
+  {
+    void *memory = nullptr;
+    if (free_ != nullptr) {
+      memory = free_;
+      free_ = free_->next_;
+      --freeSize_;
+    } else {
+      memory = ::operator new(sizeof(Node));
+    }
+    try {
+      return new (memory) Node(val, next, prev);
+    } catch (...) {
+      free_ = new (memory) FreeNode{free_};
+      ++freeSize_;
+      throw;
+    }
+  }
+
+  template< class Ty >
+  void List< Ty >::destroy_node(Node *node) noexcept
+  {
+    node->~Node();
+    if (freeSize_ < freeCapacity_) {
+      free_ = new (node) FreeNode{free_};
+      ++freeSize_;
+    } else {
+      ::operator delete(node);
+    }
+  }
+
+  template< class Ty >
+  void List< Ty >::relink_backward() noexcept
+  {
+    Node *prev = nullptr;
+    for (Node *node = head_; node != nullptr; node = node->next_) {
+      node->prev_ = prev;
+      prev = node;
+    }
+    tail_ = prev;
+  }
+
+  template< class Ty >
+  void List< Ty >::release_free_nodes() noexcept
+  {
+    while (free_ != nullptr) {
+      FreeNode *next = free_->next_;
+      ::operator delete(free_);
+      free_ = next;
+    }
+    freeSize_ = 0u;
+  }
 }
 #endif
@@ -5,10 +5,10 @@
 #include "List.h"
 
 namespace siobko {
-  template< typename Ty >
+  template< typename Ty, typename Storage = List< Ty > >
   class Queue {
   public:
-    using storage_t = List< Ty >;
+    using storage_t = Storage;
     using iterator = typename storage_t::iterator;
     using const_iterator = typename storage_t::const_iterator;
     using reference = typename storage_t::reference;
@@ -42,101 +42,101 @@ namespace siobko {
     storage_t storage_;
   };
 
-  template< typename Ty >
-  Queue< Ty >::Queue(const Queue& rhs):
+  template< typename Ty, typename Storage >
+  Queue< Ty, Storage >::Queue(const Queue& rhs):
     storage_(rhs.storage_)
   {}
 
-  template< typename Ty >
-  Queue< Ty >::Queue(Queue&& rhs) noexcept :
-    storage_(rhs.storage_)
+  template< typename Ty, typename Storage >
+  Queue< Ty, Storage >::Queue(Queue&& rhs) noexcept :
+    storage_(std::move(rhs.storage_))
   {}
 
-  template< typename Ty >
-  Queue< Ty >::Queue(std::initializer_list< value_type > IList):
+  template< typename Ty, typename Storage >
+  Queue< Ty, Storage >::Queue(std::initializer_list< value_type > IList):
     storage_(IList)
   {}
 
-  template< typename Ty >
-  Queue< Ty >::~Queue()
+  template< typename Ty, typename Storage >
+  Queue< Ty, Storage >::~Queue()
   {
     clear();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::iterator Queue< Ty >::begin() noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::iterator Queue< Ty, Storage >::begin() noexcept
   {
     return storage_.begin();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::iterator Queue< Ty >::end() noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::iterator Queue< Ty, Storage >::end() noexcept
   {
     return storage_.end();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::const_iterator Queue< Ty >::begin() const noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::const_iterator Queue< Ty, Storage >::begin() const noexcept
   {
     return storage_.cbegin();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::const_iterator Queue< Ty >::end() const noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::const_iterator Queue< Ty, Storage >::end() const noexcept
   {
     return storage_.cend();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::reference Queue< Ty >::front() noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::reference Queue< Ty, Storage >::front() noexcept
   {
     return storage_.front();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::const_reference Queue< Ty >::front() const noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::const_reference Queue< Ty, Storage >::front() const noexcept
   {
     return storage_.front();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::reference Queue< Ty >::back() noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::reference Queue< Ty, Storage >::back() noexcept
   {
     return storage_.back();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::const_reference Queue< Ty >::back() const noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::const_reference Queue< Ty, Storage >::back() const noexcept
   {
     return storage_.back();
   }
 
-  template< typename Ty >
-  typename Queue< Ty >::size_type Queue< Ty >::size() const noexcept
+  template< typename Ty, typename Storage >
+  typename Queue< Ty, Storage >::size_type Queue< Ty, Storage >::size() const noexcept
   {
     return storage_.size();
   }
 
-  template< typename Ty >
-  bool Queue< Ty >::is_empty() const noexcept
+  template< typename Ty, typename Storage >
+  bool Queue< Ty, Storage >::is_empty() const noexcept
   {
     return storage_.is_empty();
   }
 
-  template< typename Ty >
-  void Queue< Ty >::push(const Ty& obj)
+  template< typename Ty, typename Storage >
+  void Queue< Ty, Storage >::push(const Ty& obj)
   {
     storage_.push_back(obj);
   }
 
-  template< typename Ty >
-  void Queue< Ty >::pop()
+  template< typename Ty, typename Storage >
+  void Queue< Ty, Storage >::pop()
   {
     storage_.pop_front();
   }
 
-  template< typename Ty >
-  void Queue< Ty >::clear() noexcept
+  template< typename Ty, typename Storage >
+  void Queue< Ty, Storage >::clear() noexcept
   {
     storage_.clear();
   }
@@ -0,0 +1,446 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdexcept>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <new>
+
+namespace siobko {
+  template< class Ty, std::size_t FixedCapacity = 0 >
+  class RingBuffer {
+    static_assert((FixedCapacity & (FixedCapacity - 1)) == 0, "RingBuffer fixed capacity must be a power of two");
+
+  public:
+    struct ConstIterator;
+    struct Iterator;
+
+  public:
+    using size_type = std::size_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reference = Ty&;
+    using const_reference = const Ty&;
+    using value_type = Ty;
+
+    RingBuffer();
+    RingBuffer(const RingBuffer& rhs);
+    RingBuffer(RingBuffer&& rhs) noexcept;
+    RingBuffer(std::initializer_list< value_type > IList);
+    ~RingBuffer();
+
+    RingBuffer& operator=(const RingBuffer& other);
+    RingBuffer& operator=(RingBuffer&& other) noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    reference back() noexcept;
+    reference front() noexcept;
+    const_reference back() const noexcept;
+    const_reference front() const noexcept;
+
+    void push_back(const Ty& val);
+    void emplace_back(const Ty& val);
+    void pop_front();
+    void reserve(size_type capacity);
+    bool is_empty() const noexcept;
+    bool is_full() const noexcept;
+    void clear() noexcept;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+
+  private:
+    static constexpr size_type initialCapacity = 16;
+
+    void reallocate(size_type capacity);
+
+    Ty *data_;
+    size_type head_;
+    size_type size_;
+    size_type capacity_;
+  };
+
+  template< class Ty, std::size_t FixedCapacity >
+  struct RingBuffer< Ty, FixedCapacity >::ConstIterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Ty&;
+    using const_reference = const Ty&;
+    using pointer = const Ty *;
+
+    ConstIterator() = default;
+    ConstIterator(const Ty *data, std::size_t mask, std::size_t index);
+    ~ConstIterator() = default;
+
+    const_reference operator*() const noexcept;
+    pointer operator->() const noexcept;
+    ConstIterator& operator++();
+    ConstIterator operator++(int);
+    bool operator!=(const ConstIterator& other) const noexcept;
+    bool operator==(const ConstIterator& other) const noexcept;
+
+    const Ty *data_;
+    std::size_t mask_;
+    std::size_t index_;
+  };
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >::ConstIterator::ConstIterator(const Ty *data, std::size_t mask, std::size_t index):
+    data_(data),
+    mask_(mask),
+    index_(index)
+  {}
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::ConstIterator::const_reference
+  RingBuffer< Ty, FixedCapacity >::ConstIterator::operator*() const noexcept
+  {
+    return data_[index_ & mask_];
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::ConstIterator::pointer
+  RingBuffer< Ty, FixedCapacity >::ConstIterator::operator->() const noexcept
+  {
+    return data_ + (index_ & mask_);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::ConstIterator& RingBuffer< Ty, FixedCapacity >::ConstIterator::operator++()
+  {
+    ++index_;
+    return *this;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::ConstIterator RingBuffer< Ty, FixedCapacity >::ConstIterator::operator++(int)
+  {
+    ConstIterator was(*this);
+    ++(*this);
+    return was;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  bool RingBuffer< Ty, FixedCapacity >::ConstIterator::operator==(const ConstIterator& other) const noexcept
+  {
+    return index_ == other.index_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  bool RingBuffer< Ty, FixedCapacity >::ConstIterator::operator!=(const ConstIterator& other) const noexcept
+  {
+    return index_ != other.index_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  struct RingBuffer< Ty, FixedCapacity >::Iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
+    using reference = Ty&;
+    using pointer = Ty *;
+
+    Iterator() = default;
+    Iterator(Ty *data, std::size_t mask, std::size_t index);
+    ~Iterator() = default;
+
+    reference operator*() const noexcept;
+    pointer operator->() const noexcept;
+    Iterator& operator++();
+    Iterator operator++(int);
+    bool operator!=(const Iterator& other) const noexcept;
+    bool operator==(const Iterator& other) const noexcept;
+
+    Ty *data_;
+    std::size_t mask_;
+    std::size_t index_;
+  };
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >::Iterator::Iterator(Ty *data, std::size_t mask, std::size_t index):
+    data_(data),
+    mask_(mask),
+    index_(index)
+  {}
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::Iterator::reference
+  RingBuffer< Ty, FixedCapacity >::Iterator::operator*() const noexcept
+  {
+    return data_[index_ & mask_];
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::Iterator::pointer
+  RingBuffer< Ty, FixedCapacity >::Iterator::operator->() const noexcept
+  {
+    return data_ + (index_ & mask_);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::Iterator& RingBuffer< Ty, FixedCapacity >::Iterator::operator++()
+  {
+    ++index_;
+    return *this;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::Iterator RingBuffer< Ty, FixedCapacity >::Iterator::operator++(int)
+  {
+    Iterator was(*this);
+    ++(*this);
+    return was;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  bool RingBuffer< Ty, FixedCapacity >::Iterator::operator==(const Iterator& other) const noexcept
+  {
+    return index_ == other.index_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  bool RingBuffer< Ty, FixedCapacity >::Iterator::operator!=(const Iterator& other) const noexcept
+  {
+    return index_ != other.index_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >::RingBuffer():
+    data_(nullptr),
+    head_(0u),
+    size_(0u),
+    capacity_(0u)
+  {
+    if (FixedCapacity != 0u) {
+      reallocate(FixedCapacity);
+    }
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >::RingBuffer(const RingBuffer& rhs):
+    RingBuffer()
+  {
+    reserve(rhs.size_);
+    for (const Ty& item: rhs) {
+      push_back(item);
+    }
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >::RingBuffer(RingBuffer&& rhs) noexcept:
+    data_(nullptr),
+    head_(0u),
+    size_(0u),
+    capacity_(0u)
+  {
+    std::swap(rhs.data_, data_);
+    std::swap(rhs.head_, head_);
+    std::swap(rhs.size_, size_);
+    std::swap(rhs.capacity_, capacity_);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >::RingBuffer(std::initializer_list< value_type > IList):
+    RingBuffer()
+  {
+    reserve(IList.size());
+    for (const Ty& item: IList) {
+      push_back(item);
+    }
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >::~RingBuffer()
+  {
+    clear();
+    ::operator delete(data_, std::align_val_t(alignof(Ty)));
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >& RingBuffer< Ty, FixedCapacity >::operator=(const RingBuffer& other)
+  {
+    if (this != &other) {
+      (*this) = RingBuffer(other);
+    }
+    return *this;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  RingBuffer< Ty, FixedCapacity >& RingBuffer< Ty, FixedCapacity >::operator=(RingBuffer&& other) noexcept
+  {
+    if (this != &other) {
+      std::swap(data_, other.data_);
+      std::swap(head_, other.head_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    }
+    return *this;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::iterator RingBuffer< Ty, FixedCapacity >::begin() noexcept
+  {
+    return iterator(data_, capacity_ - 1, head_);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::iterator RingBuffer< Ty, FixedCapacity >::end() noexcept
+  {
+    return iterator(data_, capacity_ - 1, head_ + size_);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::const_iterator RingBuffer< Ty, FixedCapacity >::begin() const noexcept
+  {
+    return cbegin();
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::const_iterator RingBuffer< Ty, FixedCapacity >::end() const noexcept
+  {
+    return cend();
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::const_iterator RingBuffer< Ty, FixedCapacity >::cbegin() const noexcept
+  {
+    return const_iterator(data_, capacity_ - 1, head_);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::const_iterator RingBuffer< Ty, FixedCapacity >::cend() const noexcept
+  {
+    return const_iterator(data_, capacity_ - 1, head_ + size_);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::reference RingBuffer< Ty, FixedCapacity >::front() noexcept
+  {
+    return data_[head_];
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::reference RingBuffer< Ty, FixedCapacity >::back() noexcept
+  {
+    return data_[(head_ + size_ - 1) & (capacity_ - 1)];
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::const_reference RingBuffer< Ty, FixedCapacity >::front() const noexcept
+  {
+    return data_[head_];
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::const_reference RingBuffer< Ty, FixedCapacity >::back() const noexcept
+  {
+    return data_[(head_ + size_ - 1) & (capacity_ - 1)];
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  void RingBuffer< Ty, FixedCapacity >::push_back(const Ty& val)
+  {
+    if (size_ == capacity_) {
+      if (FixedCapacity != 0u) {
+        throw std::logic_error("RingBuffer push back error: RingBuffer is full.");
+      }
+      Ty copy(val);
+      reallocate(capacity_ == 0u ? initialCapacity : capacity_ * 2);
+      new (data_ + ((head_ + size_) & (capacity_ - 1))) Ty(std::move(copy));
+    } else {
+      new (data_ + ((head_ + size_) & (capacity_ - 1))) Ty(val);
+    }
+    ++size_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  void RingBuffer< Ty, FixedCapacity >::emplace_back(const Ty& val)
+  {
+    push_back(val);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  void RingBuffer< Ty, FixedCapacity >::pop_front()
+  {
+    if (is_empty()) {
+      throw std::logic_error("RingBuffer pop front error: RingBuffer is empty.");
+    }
+    data_[head_].~Ty();
+    head_ = (head_ + 1) & (capacity_ - 1);
+    --size_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  void RingBuffer< Ty, FixedCapacity >::reserve(size_type capacity)
+  {
+    if (capacity <= capacity_) {
+      return;
+    }
+    if (FixedCapacity != 0u) {
+      throw std::logic_error("RingBuffer reserve error: RingBuffer has fixed capacity.");
+    }
+    size_type newCapacity = (capacity_ == 0u) ? initialCapacity : capacity_;
+    while (newCapacity < capacity) {
+      newCapacity *= 2;
+    }
+    reallocate(newCapacity);
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  bool RingBuffer< Ty, FixedCapacity >::is_empty() const noexcept
+  {
+    return size_ == 0u;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  bool RingBuffer< Ty, FixedCapacity >::is_full() const noexcept
+  {
+    return size_ == capacity_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  void RingBuffer< Ty, FixedCapacity >::clear() noexcept
+  {
+    while (size_ != 0u) {
+      data_[head_].~Ty();
+      head_ = (head_ + 1) & (capacity_ - 1);
+      --size_;
+    }
+    head_ = 0u;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::size_type RingBuffer< Ty, FixedCapacity >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  typename RingBuffer< Ty, FixedCapacity >::size_type RingBuffer< Ty, FixedCapacity >::capacity() const noexcept
+  {
+    return capacity_;
+  }
+
+  template< class Ty, std::size_t FixedCapacity >
+  void RingBuffer< Ty, FixedCapacity >::reallocate(size_type capacity)
+  {
+    Ty *data = static_cast< Ty * >(::operator new(capacity * sizeof(Ty), std::align_val_t(alignof(Ty))));
+    for (size_type i = 0u; i < size_; ++i) {
+      Ty& item = data_[(head_ + i) & (capacity_ - 1)];
+      new (data + i) Ty(std::move(item));
+      item.~Ty();
+    }
+    ::operator delete(data_, std::align_val_t(alignof(Ty)));
+    data_ = data;
+    head_ = 0u;
+    capacity_ = capacity;
+  }
+}
+#endif
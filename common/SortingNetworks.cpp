@@ -0,0 +1,235 @@
+#include "SortingNetworks.h"
+
+#include <limits>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIOBKO_X86_NETWORKS 1
+#include <immintrin.h>
+#define SIOBKO_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace siobko {
+  namespace {
+    constexpr std::size_t minimumBlockSize = 8u;
+
+    template< typename Ty >
+    using step_t = void (*)(Ty *data, std::size_t size, std::size_t distance);
+
+    template< typename Ty >
+    void scalarStep(Ty *data, std::size_t size, std::size_t distance)
+    {
+      for (std::size_t i = 0u; i < size; ++i) {
+        std::size_t partner = i ^ distance;
+        if (partner > i) {
+          Ty low = std::min(data[i], data[partner]);
+          Ty high = std::max(data[i], data[partner]);
+          data[i] = low;
+          data[partner] = high;
+        }
+      }
+    }
+
+    std::size_t highestBit(std::size_t value)
+    {
+      std::size_t result = 1u;
+      while ((result << 1) <= value) {
+        result <<= 1;
+      }
+      return result;
+    }
+
+#ifdef SIOBKO_X86_NETWORKS
+    SIOBKO_TARGET("avx2")
+    void avx2Step(int *data, std::size_t size, std::size_t distance)
+    {
+      constexpr std::size_t lanes = 8u;
+      std::size_t lane = distance & (lanes - 1);
+      __m256i index = _mm256_setr_epi32(0 ^ lane, 1 ^ lane, 2 ^ lane, 3 ^ lane, 4 ^ lane, 5 ^ lane, 6 ^ lane, 7 ^ lane);
+      if (distance >= lanes) {
+        std::size_t block = distance & ~(lanes - 1);
+        for (std::size_t i = 0u; i < size; i += lanes) {
+          std::size_t partner = i ^ block;
+          if (partner < i) {
+            continue;
+          }
+          __m256i a = _mm256_load_si256(reinterpret_cast< __m256i * >(data + i));
+          __m256i b = _mm256_permutevar8x32_epi32(_mm256_load_si256(reinterpret_cast< __m256i * >(data + partner)), index);
+          _mm256_store_si256(reinterpret_cast< __m256i * >(data + i), _mm256_min_epi32(a, b));
+          __m256i high = _mm256_permutevar8x32_epi32(_mm256_max_epi32(a, b), index);
+          _mm256_store_si256(reinterpret_cast< __m256i * >(data + partner), high);
+        }
+        return;
+      }
+      int bit = static_cast< int >(highestBit(distance));
+      __m256i upper = _mm256_cmpgt_epi32(_mm256_and_si256(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+          _mm256_set1_epi32(bit)), _mm256_setzero_si256());
+      for (std::size_t i = 0u; i < size; i += lanes) {
+        __m256i a = _mm256_load_si256(reinterpret_cast< __m256i * >(data + i));
+        __m256i b = _mm256_permutevar8x32_epi32(a, index);
+        __m256i result = _mm256_blendv_epi8(_mm256_min_epi32(a, b), _mm256_max_epi32(a, b), upper);
+        _mm256_store_si256(reinterpret_cast< __m256i * >(data + i), result);
+      }
+    }
+
+    SIOBKO_TARGET("avx2")
+    void avx2Step(double *data, std::size_t size, std::size_t distance)
+    {
+      constexpr std::size_t lanes = 4u;
+      int lane = static_cast< int >(distance & (lanes - 1));
+      __m256i index = _mm256_setr_epi32(2 * (0 ^ lane), 2 * (0 ^ lane) + 1, 2 * (1 ^ lane), 2 * (1 ^ lane) + 1,
+          2 * (2 ^ lane), 2 * (2 ^ lane) + 1, 2 * (3 ^ lane), 2 * (3 ^ lane) + 1);
+      if (distance >= lanes) {
+        std::size_t block = distance & ~(lanes - 1);
+        for (std::size_t i = 0u; i < size; i += lanes) {
+          std::size_t partner = i ^ block;
+          if (partner < i) {
+            continue;
+          }
+          __m256d a = _mm256_load_pd(data + i);
+          __m256d b = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(_mm256_load_pd(data + partner)), index));
+          _mm256_store_pd(data + i, _mm256_min_pd(a, b));
+          __m256d high = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(_mm256_max_pd(a, b)), index));
+          _mm256_store_pd(data + partner, high);
+        }
+        return;
+      }
+      long long bit = static_cast< long long >(highestBit(distance));
+      __m256d upper = _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_and_si256(_mm256_setr_epi64x(0, 1, 2, 3),
+          _mm256_set1_epi64x(bit)), _mm256_setzero_si256()));
+      for (std::size_t i = 0u; i < size; i += lanes) {
+        __m256d a = _mm256_load_pd(data + i);
+        __m256d b = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(a), index));
+        _mm256_store_pd(data + i, _mm256_blendv_pd(_mm256_min_pd(a, b), _mm256_max_pd(a, b), upper));
+      }
+    }
+
+    SIOBKO_TARGET("sse4.1")
+    void sse41Step(int *data, std::size_t size, std::size_t distance)
+    {
+      constexpr std::size_t lanes = 4u;
+      char lane = static_cast< char >(distance & (lanes - 1));
+      __m128i index = _mm_setr_epi8(4 * (0 ^ lane), 4 * (0 ^ lane) + 1, 4 * (0 ^ lane) + 2, 4 * (0 ^ lane) + 3,
+          4 * (1 ^ lane), 4 * (1 ^ lane) + 1, 4 * (1 ^ lane) + 2, 4 * (1 ^ lane) + 3,
+          4 * (2 ^ lane), 4 * (2 ^ lane) + 1, 4 * (2 ^ lane) + 2, 4 * (2 ^ lane) + 3,
+          4 * (3 ^ lane), 4 * (3 ^ lane) + 1, 4 * (3 ^ lane) + 2, 4 * (3 ^ lane) + 3);
+      if (distance >= lanes) {
+        std::size_t block = distance & ~(lanes - 1);
+        for (std::size_t i = 0u; i < size; i += lanes) {
+          std::size_t partner = i ^ block;
+          if (partner < i) {
+            continue;
+          }
+          __m128i a = _mm_load_si128(reinterpret_cast< __m128i * >(data + i));
+          __m128i b = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast< __m128i * >(data + partner)), index);
+          _mm_store_si128(reinterpret_cast< __m128i * >(data + i), _mm_min_epi32(a, b));
+          _mm_store_si128(reinterpret_cast< __m128i * >(data + partner), _mm_shuffle_epi8(_mm_max_epi32(a, b), index));
+        }
+        return;
+      }
+      int bit = static_cast< int >(highestBit(distance));
+      __m128i upper = _mm_cmpgt_epi32(_mm_and_si128(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(bit)),
+          _mm_setzero_si128());
+      for (std::size_t i = 0u; i < size; i += lanes) {
+        __m128i a = _mm_load_si128(reinterpret_cast< __m128i * >(data + i));
+        __m128i b = _mm_shuffle_epi8(a, index);
+        __m128i result = _mm_blendv_epi8(_mm_min_epi32(a, b), _mm_max_epi32(a, b), upper);
+        _mm_store_si128(reinterpret_cast< __m128i * >(data + i), result);
+      }
+    }
+
+    SIOBKO_TARGET("sse4.1")
+    void sse41Step(double *data, std::size_t size, std::size_t distance)
+    {
+      constexpr std::size_t lanes = 2u;
+      bool swapped = (distance & (lanes - 1)) != 0u;
+      if (distance >= lanes) {
+        std::size_t block = distance & ~(lanes - 1);
+        for (std::size_t i = 0u; i < size; i += lanes) {
+          std::size_t partner = i ^ block;
+          if (partner < i) {
+            continue;
+          }
+          __m128d a = _mm_load_pd(data + i);
+          __m128d b = _mm_load_pd(data + partner);
+          if (swapped) {
+            b = _mm_shuffle_pd(b, b, 1);
+          }
+          __m128d high = _mm_max_pd(a, b);
+          _mm_store_pd(data + i, _mm_min_pd(a, b));
+          _mm_store_pd(data + partner, swapped ? _mm_shuffle_pd(high, high, 1) : high);
+        }
+        return;
+      }
+      for (std::size_t i = 0u; i < size; i += lanes) {
+        __m128d a = _mm_load_pd(data + i);
+        __m128d b = _mm_shuffle_pd(a, a, 1);
+        _mm_store_pd(data + i, _mm_shuffle_pd(_mm_min_pd(a, b), _mm_max_pd(a, b), 2));
+      }
+    }
+#endif
+
+    template< typename Ty >
+    step_t< Ty > chooseStep()
+    {
+#ifdef SIOBKO_X86_NETWORKS
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2")) {
+        return avx2Step;
+      }
+      if (__builtin_cpu_supports("sse4.1")) {
+        return sse41Step;
+      }
+#endif
+      return scalarStep< Ty >;
+    }
+
+    template< typename Ty >
+    void bitonicSort(Ty *first, std::size_t size, bool descending)
+    {
+      static const step_t< Ty > step = chooseStep< Ty >();
+
+      if (size > static_cast< std::size_t >(sortingNetworkMaxSize)) {
+        throw std::logic_error("Sorting network error: too many elements.");
+      }
+      if (size < 2u) {
+        return;
+      }
+
+      std::size_t padded = minimumBlockSize;
+      while (padded < size) {
+        padded <<= 1;
+      }
+      Ty sentinel = descending ? std::numeric_limits< Ty >::lowest() : std::numeric_limits< Ty >::max();
+      if (std::numeric_limits< Ty >::has_infinity) {
+        sentinel = descending ? -std::numeric_limits< Ty >::infinity() : std::numeric_limits< Ty >::infinity();
+      }
+      alignas(32) Ty buffer[sortingNetworkMaxSize];
+      std::copy(first, first + size, buffer);
+      std::fill(buffer + size, buffer + padded, sentinel);
+
+      for (std::size_t block = 2u; block <= padded; block <<= 1) {
+        step(buffer, padded, block - 1);
+        for (std::size_t distance = block >> 2; distance > 0u; distance >>= 1) {
+          step(buffer, padded, distance);
+        }
+      }
+
+      if (descending) {
+        std::reverse_copy(buffer + padded - size, buffer + padded, first);
+      } else {
+        std::copy(buffer, buffer + size, first);
+      }
+    }
+  }
+
+  void networkSort(int *first, std::size_t size, bool descending)
+  {
+    bitonicSort(first, size, descending);
+  }
+
+  void networkSort(double *first, std::size_t size, bool descending)
+  {
+    bitonicSort(first, size, descending);
+  }
+}
@@ -0,0 +1,53 @@
+#ifndef SORTING_NETWORKS_H
+#define SORTING_NETWORKS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "CompareTraits.h"
+
+namespace siobko {
+  constexpr std::ptrdiff_t sortingNetworkMinSize = 16;
+  constexpr std::ptrdiff_t sortingNetworkMaxSize = 64;
+
+  void networkSort(int *first, std::size_t size, bool descending);
+  void networkSort(double *first, std::size_t size, bool descending);
+
+  template< typename Ty, typename Compare >
+  struct NetworkOrder {
+    static constexpr bool supported = CompareOrder< Ty, Compare >::known && !CompareInstrumented< Compare >::value
+        && (std::is_same< Ty, int >::value || std::is_same< Ty, double >::value);
+    static constexpr bool descending = CompareOrder< Ty, Compare >::descending;
+  };
+
+  namespace detail {
+    template< typename Iterator, typename Ty >
+    constexpr bool isContiguous()
+    {
+      return std::is_same< Iterator, Ty * >::value || std::is_same< Iterator, typename std::vector< Ty >::iterator >::value;
+    }
+  }
+
+  template< typename RandomAccessIterator >
+  void networkSort(RandomAccessIterator first, RandomAccessIterator last, bool descending)
+  {
+    using value_type = typename std::iterator_traits< RandomAccessIterator >::value_type;
+
+    std::size_t size = last - first;
+    if (size < 2u) {
+      return;
+    }
+    if constexpr (detail::isContiguous< RandomAccessIterator, value_type >()) {
+      networkSort(&*first, size, descending);
+    } else {
+      value_type buffer[sortingNetworkMaxSize];
+      std::copy(first, last, buffer);
+      networkSort(buffer, size, descending);
+      std::copy(buffer, buffer + size, first);
+    }
+  }
+}
+#endif
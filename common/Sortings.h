@@ -5,16 +5,102 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "CompareTraits.h"
+#include "SortingNetworks.h"
+#include "ThreadPool.h"
 
 namespace siobko{
+  constexpr std::size_t defaultGrainSize = 8192;
+
+  struct Identity {
+    template< typename Ty >
+    constexpr Ty&& operator()(Ty&& value) const noexcept
+    {
+      return std::forward< Ty >(value);
+    }
+  };
+
+  template< typename Container, typename Compare >
+  void bucketSort(Container& container, std::size_t size, Compare cmp);
+
+  template< typename Container, typename Compare, typename Projection >
+  void bucketSort(Container& container, std::size_t size, Compare cmp, Projection proj);
+
   template< typename Container, typename Compare >
-  void bucketSort(Container& container, Compare cmp);
+  void bucketSort(ExecutionPolicy policy, Container& container, std::size_t size, Compare cmp,
+      std::size_t grainSize = defaultGrainSize, ThreadPool& pool = ThreadPool::global());
+
+  template< typename ForwardIterator, typename Compare >
+  void mergeSort(ForwardIterator left, ForwardIterator right, Compare cmp);
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void mergeSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj);
+
+  template< typename RandomAccessIterator, typename Compare >
+  void mergeSort(ExecutionPolicy policy, RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      std::size_t grainSize = defaultGrainSize, ThreadPool& pool = ThreadPool::global());
+
+  template< typename ForwardIterator, typename Compare >
+  void timSort(ForwardIterator left, ForwardIterator right, Compare cmp);
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void timSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj);
+
+  template< typename ForwardIterator, typename Compare >
+  void quickSort(ForwardIterator left, ForwardIterator right, Compare cmp);
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void quickSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj);
+
+  template< typename RandomAccessIterator, typename Compare >
+  void quickSort(ExecutionPolicy policy, RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      std::size_t grainSize = defaultGrainSize, ThreadPool& pool = ThreadPool::global());
+
+  template< typename ForwardIterator, typename Compare >
+  void sampleSort(ForwardIterator left, ForwardIterator right, Compare cmp);
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void sampleSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj);
 
   template< typename RandomAccessIterator, typename Compare >
-  void mergeSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp);
+  void sampleSort(ExecutionPolicy policy, RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      std::size_t grainSize = defaultGrainSize, ThreadPool& pool = ThreadPool::global());
+
+  template< typename ForwardIterator, typename Compare >
+  void radixSort(ForwardIterator left, ForwardIterator right, Compare cmp);
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void radixSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj);
 
   template< typename RandomAccessIterator, typename Compare >
-  void quickSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp);
+  std::vector< std::size_t > argsort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp);
+
+  template< typename RandomAccessIterator, typename Compare, typename Projection >
+  std::vector< std::size_t > argsort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      Projection proj);
+
+  template< typename KeyIterator, typename ValueIterator, typename Compare >
+  void coSort(KeyIterator keysLeft, KeyIterator keysRight, ValueIterator values, Compare cmp);
+
+  template< typename KeyIterator, typename ValueIterator, typename Compare, typename Projection >
+  void coSort(KeyIterator keysLeft, KeyIterator keysRight, ValueIterator values, Compare cmp, Projection proj);
+
+  template< typename RandomAccessIterator, typename Compare >
+  void nthElement(RandomAccessIterator left, RandomAccessIterator nth, RandomAccessIterator right, Compare cmp);
+
+  template< typename RandomAccessIterator, typename Compare >
+  void partialSort(RandomAccessIterator left, RandomAccessIterator middle, RandomAccessIterator right, Compare cmp);
+
+  template< typename InputIterator, typename Compare >
+  std::vector< typename std::iterator_traits< InputIterator >::value_type > topK(InputIterator first,
+      InputIterator last, std::size_t k, Compare cmp);
 
   template< typename RandomAccessIterator, typename Compare >
   RandomAccessIterator partition(RandomAccessIterator left, RandomAccessIterator right, Compare cmp);
@@ -22,94 +108,1455 @@ namespace siobko{
   template< typename RandomAccessIterator, typename Compare >
   void merge(RandomAccessIterator left, RandomAccessIterator middle, RandomAccessIterator right, Compare cmp);
 
-  template< typename Container, typename Compare >
-  void bucketSort(Container& container, std::size_t size, Compare cmp)
-  {
-    using value_type = typename Container::value_type;
+  template< typename RangeIterator, typename OutputIterator, typename Compare >
+  OutputIterator kWayMerge(RangeIterator firstRange, RangeIterator lastRange, OutputIterator out, Compare cmp);
+
+  namespace detail {
+    constexpr std::ptrdiff_t insertionSortThreshold = 16;
+    constexpr std::ptrdiff_t nintherThreshold = 128;
+    constexpr std::ptrdiff_t mergeSortRunSize = 32;
+    constexpr std::ptrdiff_t timSortMinMerge = 64;
+    constexpr std::ptrdiff_t timSortMinGallop = 7;
+    constexpr std::size_t partitionBlockSize = 64;
+
+    template< typename RandomAccessIterator, typename Sorter >
+    void sortRange(RandomAccessIterator left, RandomAccessIterator right, Sorter sorter,
+        std::random_access_iterator_tag)
+    {
+      sorter(left, right);
+    }
+
+    template< typename ForwardIterator, typename Sorter >
+    void sortRange(ForwardIterator left, ForwardIterator right, Sorter sorter, std::forward_iterator_tag)
+    {
+      std::vector< typename std::iterator_traits< ForwardIterator >::value_type > buffer(
+          std::make_move_iterator(left), std::make_move_iterator(right));
+      sorter(buffer.begin(), buffer.end());
+      std::move(buffer.begin(), buffer.end(), left);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void insertionSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      if (left == right) {
+        return;
+      }
+      for (RandomAccessIterator i = std::next(left); i != right; ++i) {
+        if (!cmp(*i, *std::prev(i))) {
+          continue;
+        }
+        auto value = std::move(*i);
+        RandomAccessIterator j = i;
+        do {
+          *j = std::move(*std::prev(j));
+          --j;
+        } while (j != left && cmp(value, *std::prev(j)));
+        *j = std::move(value);
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    constexpr std::ptrdiff_t smallSortThreshold()
+    {
+      using value_type = typename std::iterator_traits< RandomAccessIterator >::value_type;
+      return NetworkOrder< value_type, Compare >::supported ? sortingNetworkMaxSize : insertionSortThreshold;
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void smallSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      using order = NetworkOrder< typename std::iterator_traits< RandomAccessIterator >::value_type, Compare >;
+      if constexpr (order::supported) {
+        if (right - left >= sortingNetworkMinSize) {
+          networkSort(left, right, order::descending);
+          return;
+        }
+      }
+      insertionSort(left, right, cmp);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void heapSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      std::make_heap(left, right, cmp);
+      std::sort_heap(left, right, cmp);
+    }
+
+    template< typename InputIterator, typename OutputIterator, typename Compare >
+    OutputIterator moveMerge(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2,
+        OutputIterator out, Compare cmp)
+    {
+      while (first1 != last1 && first2 != last2) {
+        if (cmp(*first2, *first1)) {
+          *out = std::move(*first2);
+          ++first2;
+        } else {
+          *out = std::move(*first1);
+          ++first1;
+        }
+        ++out;
+      }
+      out = std::move(first1, last1, out);
+      return std::move(first2, last2, out);
+    }
+
+    template< typename InputIterator, typename OutputIterator, typename Compare >
+    void mergePass(InputIterator first, InputIterator last, OutputIterator out, std::ptrdiff_t width, Compare cmp)
+    {
+      std::ptrdiff_t size = last - first;
+      for (std::ptrdiff_t i = 0; i < size; i += 2 * width) {
+        InputIterator middle = first + std::min(i + width, size);
+        InputIterator end = first + std::min(i + 2 * width, size);
+        out = moveMerge(first + i, middle, middle, end, out, cmp);
+      }
+    }
+
+    template< typename RandomAccessIterator, typename BufferIterator, typename Compare >
+    void bottomUpMergeSort(RandomAccessIterator left, RandomAccessIterator right, BufferIterator buffer, Compare cmp)
+    {
+      std::ptrdiff_t size = right - left;
+      for (std::ptrdiff_t i = 0; i < size; i += mergeSortRunSize) {
+        smallSort(left + i, left + std::min(i + mergeSortRunSize, size), cmp);
+      }
+
+      bool inBuffer = false;
+      for (std::ptrdiff_t width = mergeSortRunSize; width < size; width *= 2) {
+        if (inBuffer) {
+          mergePass(buffer, buffer + size, left, width, cmp);
+        } else {
+          mergePass(left, right, buffer, width, cmp);
+        }
+        inBuffer = !inBuffer;
+      }
+      if (inBuffer) {
+        std::move(buffer, buffer + size, left);
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void mergeSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+        std::random_access_iterator_tag)
+    {
+      if (right - left <= mergeSortRunSize) {
+        smallSort(left, right, cmp);
+        return;
+      }
+      std::vector< typename std::iterator_traits< RandomAccessIterator >::value_type > buffer(left, right);
+      bottomUpMergeSort(left, right, buffer.begin(), cmp);
+    }
+
+    template< typename InputIterator >
+    struct RangeSource {
+      bool next(typename std::iterator_traits< InputIterator >::value_type& value)
+      {
+        if (first == last) {
+          return false;
+        }
+        value = *first;
+        ++first;
+        return true;
+      }
+
+      InputIterator first;
+      InputIterator last;
+    };
+
+    template< typename Ty >
+    struct LoserTreeNode {
+      Ty key;
+      std::size_t source;
+      bool exhausted;
+    };
+
+    template< typename Ty, typename Compare >
+    bool beats(const LoserTreeNode< Ty >& lhs, const LoserTreeNode< Ty >& rhs, Compare cmp)
+    {
+      if (lhs.exhausted || rhs.exhausted) {
+        return !lhs.exhausted || (rhs.exhausted && lhs.source < rhs.source);
+      }
+      return lhs.source < rhs.source ? !cmp(rhs.key, lhs.key) : cmp(lhs.key, rhs.key);
+    }
+
+    template< typename Ty, typename Source, typename Consumer, typename Compare >
+    void loserTreeMerge(std::vector< Source >& sources, Consumer consume, Compare cmp)
+    {
+      std::size_t size = sources.size();
+      if (size == 0u) {
+        return;
+      }
+      std::vector< LoserTreeNode< Ty > > leaves(size);
+      for (std::size_t i = 0u; i < size; ++i) {
+        leaves[i].source = i;
+        leaves[i].exhausted = !sources[i].next(leaves[i].key);
+      }
+
+      std::vector< LoserTreeNode< Ty > > tree(size);
+      std::vector< LoserTreeNode< Ty > > winners(size);
+      for (std::size_t node = size - 1; node > 0u; --node) {
+        LoserTreeNode< Ty >& left = 2 * node < size ? winners[2 * node] : leaves[2 * node - size];
+        LoserTreeNode< Ty >& right = 2 * node + 1 < size ? winners[2 * node + 1] : leaves[2 * node + 1 - size];
+        bool leftWins = beats(left, right, cmp);
+        winners[node] = std::move(leftWins ? left : right);
+        tree[node] = std::move(leftWins ? right : left);
+      }
+      LoserTreeNode< Ty > winner = std::move(size > 1u ? winners[1] : leaves[0]);
+      winners.clear();
+      leaves.clear();
+
+      while (!winner.exhausted) {
+        consume(std::move(winner.key));
+        winner.exhausted = !sources[winner.source].next(winner.key);
+        for (std::size_t node = (winner.source + size) / 2; node > 0u; node /= 2) {
+          if (beats(tree[node], winner, cmp)) {
+            std::swap(tree[node], winner);
+          }
+        }
+      }
+    }
+
+    struct TimSortRun {
+      std::ptrdiff_t base;
+      std::ptrdiff_t length;
+    };
+
+    inline std::ptrdiff_t minRunLength(std::ptrdiff_t size)
+    {
+      std::ptrdiff_t remainder = 0;
+      while (size >= timSortMinMerge) {
+        remainder |= size & 1;
+        size >>= 1;
+      }
+      return size + remainder;
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    RandomAccessIterator countRunAndMakeAscending(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      RandomAccessIterator next = std::next(left);
+      if (next == right) {
+        return right;
+      }
+      if (cmp(*next, *left)) {
+        while (++next != right && cmp(*next, *std::prev(next))) {
+        }
+        std::reverse(left, next);
+      } else {
+        while (++next != right && !cmp(*next, *std::prev(next))) {
+        }
+      }
+      return next;
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void binaryInsertionSort(RandomAccessIterator left, RandomAccessIterator sorted, RandomAccessIterator right,
+        Compare cmp)
+    {
+      for (; sorted != right; ++sorted) {
+        RandomAccessIterator position = std::upper_bound(left, sorted, *sorted, cmp);
+        if (position == sorted) {
+          continue;
+        }
+        auto value = std::move(*sorted);
+        std::move_backward(position, sorted, std::next(sorted));
+        *position = std::move(value);
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Predicate >
+    RandomAccessIterator gallop(RandomAccessIterator first, RandomAccessIterator last, Predicate pred, bool fromBack)
+    {
+      std::ptrdiff_t size = last - first;
+      std::ptrdiff_t low = 0;
+      std::ptrdiff_t high = size;
+      std::ptrdiff_t step = 0;
+      if (fromBack) {
+        while (step < size && !pred(first[size - 1 - step])) {
+          high = size - 1 - step;
+          step = 2 * step + 1;
+        }
+        low = size - std::min(step, size);
+      } else {
+        while (step < size && pred(first[step])) {
+          low = step + 1;
+          step = 2 * step + 1;
+        }
+        high = std::min(step, size);
+      }
+      return std::partition_point(first + low, first + high, pred);
+    }
+
+    template< typename RandomAccessIterator, typename Ty, typename Compare >
+    void mergeLow(RandomAccessIterator left, RandomAccessIterator middle, RandomAccessIterator right,
+        std::vector< Ty >& buffer, std::ptrdiff_t& minGallop, Compare cmp)
+    {
+      buffer.assign(std::make_move_iterator(left), std::make_move_iterator(middle));
+      auto first1 = buffer.begin();
+      auto last1 = buffer.end();
+      RandomAccessIterator first2 = middle;
+      RandomAccessIterator out = left;
+      while (first1 != last1 && first2 != right) {
+        std::ptrdiff_t count1 = 0;
+        std::ptrdiff_t count2 = 0;
+        while (first1 != last1 && first2 != right && std::max(count1, count2) < minGallop) {
+          if (cmp(*first2, *first1)) {
+            *out++ = std::move(*first2++);
+            ++count2;
+            count1 = 0;
+          } else {
+            *out++ = std::move(*first1++);
+            ++count1;
+            count2 = 0;
+          }
+        }
+        while (first1 != last1 && first2 != right) {
+          auto gallop1 = gallop(first1, last1, [&](const Ty& value) {
+            return !cmp(*first2, value);
+          }, false);
+          count1 = gallop1 - first1;
+          out = std::move(first1, gallop1, out);
+          first1 = gallop1;
+          if (first1 == last1) {
+            break;
+          }
+          *out++ = std::move(*first2++);
+          if (first2 == right) {
+            break;
+          }
+          RandomAccessIterator gallop2 = gallop(first2, right, [&](const Ty& value) {
+            return cmp(value, *first1);
+          }, false);
+          count2 = gallop2 - first2;
+          out = std::move(first2, gallop2, out);
+          first2 = gallop2;
+          if (first2 == right) {
+            break;
+          }
+          *out++ = std::move(*first1++);
+          minGallop = std::max< std::ptrdiff_t >(minGallop - 1, 1);
+          if (count1 < timSortMinGallop && count2 < timSortMinGallop) {
+            minGallop += 2;
+            break;
+          }
+        }
+      }
+      std::move(first1, last1, out);
+    }
+
+    template< typename RandomAccessIterator, typename Ty, typename Compare >
+    void mergeHigh(RandomAccessIterator left, RandomAccessIterator middle, RandomAccessIterator right,
+        std::vector< Ty >& buffer, std::ptrdiff_t& minGallop, Compare cmp)
+    {
+      buffer.assign(std::make_move_iterator(middle), std::make_move_iterator(right));
+      RandomAccessIterator last1 = middle;
+      auto first2 = buffer.begin();
+      auto last2 = buffer.end();
+      RandomAccessIterator out = right;
+      while (last1 != left && last2 != first2) {
+        std::ptrdiff_t count1 = 0;
+        std::ptrdiff_t count2 = 0;
+        while (last1 != left && last2 != first2 && std::max(count1, count2) < minGallop) {
+          if (cmp(*std::prev(last2), *std::prev(last1))) {
+            *--out = std::move(*--last1);
+            ++count1;
+            count2 = 0;
+          } else {
+            *--out = std::move(*--last2);
+            ++count2;
+            count1 = 0;
+          }
+        }
+        while (last1 != left && last2 != first2) {
+          RandomAccessIterator gallop1 = gallop(left, last1, [&](const Ty& value) {
+            return !cmp(*std::prev(last2), value);
+          }, true);
+          count1 = last1 - gallop1;
+          out = std::move_backward(gallop1, last1, out);
+          last1 = gallop1;
+          if (last1 == left) {
+            break;
+          }
+          *--out = std::move(*--last2);
+          if (last2 == first2) {
+            break;
+          }
+          auto gallop2 = gallop(first2, last2, [&](const Ty& value) {
+            return cmp(value, *std::prev(last1));
+          }, true);
+          count2 = last2 - gallop2;
+          out = std::move_backward(gallop2, last2, out);
+          last2 = gallop2;
+          if (last2 == first2) {
+            break;
+          }
+          *--out = std::move(*--last1);
+          minGallop = std::max< std::ptrdiff_t >(minGallop - 1, 1);
+          if (count1 < timSortMinGallop && count2 < timSortMinGallop) {
+            minGallop += 2;
+            break;
+          }
+        }
+      }
+      std::move_backward(first2, last2, out);
+    }
+
+    template< typename RandomAccessIterator, typename Ty, typename Compare >
+    void mergeRunsAt(RandomAccessIterator left, std::vector< TimSortRun >& runs, std::size_t i,
+        std::vector< Ty >& buffer, std::ptrdiff_t& minGallop, Compare cmp)
+    {
+      RandomAccessIterator first = left + runs[i].base;
+      RandomAccessIterator middle = left + runs[i + 1].base;
+      RandomAccessIterator last = middle + runs[i + 1].length;
+      runs[i].length += runs[i + 1].length;
+      runs.erase(runs.begin() + i + 1);
+
+      first = gallop(first, middle, [&](const Ty& value) {
+        return !cmp(*middle, value);
+      }, false);
+      if (first == middle) {
+        return;
+      }
+      last = gallop(middle, last, [&](const Ty& value) {
+        return cmp(value, *std::prev(middle));
+      }, true);
+      if (middle - first <= last - middle) {
+        mergeLow(first, middle, last, buffer, minGallop, cmp);
+      } else {
+        mergeHigh(first, middle, last, buffer, minGallop, cmp);
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Ty, typename Compare >
+    void collapseRuns(RandomAccessIterator left, std::vector< TimSortRun >& runs, std::vector< Ty >& buffer,
+        std::ptrdiff_t& minGallop, Compare cmp, bool force)
+    {
+      while (runs.size() > 1u) {
+        std::size_t n = runs.size() - 2u;
+        bool violated = (n > 0u && runs[n - 1].length <= runs[n].length + runs[n + 1].length)
+            || (n > 1u && runs[n - 2].length <= runs[n - 1].length + runs[n].length);
+        if (force || violated) {
+          if (n > 0u && runs[n - 1].length < runs[n + 1].length) {
+            --n;
+          }
+        } else if (runs[n].length > runs[n + 1].length) {
+          break;
+        }
+        mergeRunsAt(left, runs, n, buffer, minGallop, cmp);
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void timSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp, std::random_access_iterator_tag)
+    {
+      std::ptrdiff_t size = right - left;
+      if (size < 2) {
+        return;
+      }
+
+      std::ptrdiff_t minRun = minRunLength(size);
+      std::vector< TimSortRun > runs;
+      std::vector< typename std::iterator_traits< RandomAccessIterator >::value_type > buffer;
+      std::ptrdiff_t minGallop = timSortMinGallop;
+      for (RandomAccessIterator first = left; first != right;) {
+        RandomAccessIterator last = countRunAndMakeAscending(first, right, cmp);
+        if (last - first < minRun) {
+          RandomAccessIterator forced = first + std::min(minRun, right - first);
+          binaryInsertionSort(first, last, forced, cmp);
+          last = forced;
+        }
+        runs.push_back({first - left, last - first});
+        collapseRuns(left, runs, buffer, minGallop, cmp, false);
+        first = last;
+      }
+      collapseRuns(left, runs, buffer, minGallop, cmp, true);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void sortThree(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, Compare cmp)
+    {
+      if (cmp(*b, *a)) {
+        std::iter_swap(a, b);
+      }
+      if (cmp(*c, *b)) {
+        std::iter_swap(b, c);
+        if (cmp(*b, *a)) {
+          std::iter_swap(a, b);
+        }
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void choosePivot(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      auto size = right - left;
+      RandomAccessIterator middle = left + size / 2;
+      if (size > nintherThreshold) {
+        sortThree(left, middle, right - 1, cmp);
+        sortThree(left + 1, middle - 1, right - 2, cmp);
+        sortThree(left + 2, middle + 1, right - 3, cmp);
+        sortThree(middle - 1, middle, middle + 1, cmp);
+        std::iter_swap(left, middle);
+      } else {
+        sortThree(middle, left, right - 1, cmp);
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    RandomAccessIterator partition(RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+        std::random_access_iterator_tag)
+    {
+      RandomAccessIterator i = left;
+      RandomAccessIterator j = right;
+      while (true) {
+        while (++i != right && cmp(*i, *left)) {}
+        while (cmp(*left, *--j)) {}
+        if (!(i < j)) {
+          break;
+        }
+        std::iter_swap(i, j);
+      }
+      std::iter_swap(left, j);
+      return j;
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    constexpr bool isCheapCompare()
+    {
+      using value_type = typename std::iterator_traits< RandomAccessIterator >::value_type;
+      return std::is_arithmetic< value_type >::value && CompareOrder< value_type, Compare >::known;
+    }
+
+    template< typename RandomAccessIterator >
+    void swapOffsets(RandomAccessIterator leftBase, RandomAccessIterator rightBase, const unsigned char *leftOffsets,
+        const unsigned char *rightOffsets, std::size_t amount)
+    {
+      if (amount == 0u) {
+        return;
+      }
+      RandomAccessIterator l = leftBase + leftOffsets[0];
+      RandomAccessIterator r = rightBase - rightOffsets[0];
+      auto tmp = std::move(*l);
+      *l = std::move(*r);
+      for (std::size_t i = 1u; i < amount; ++i) {
+        l = leftBase + leftOffsets[i];
+        *r = std::move(*l);
+        r = rightBase - rightOffsets[i];
+        *l = std::move(*r);
+      }
+      *r = std::move(tmp);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    RandomAccessIterator blockPartition(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      const auto pivot = *left;
+      RandomAccessIterator first = left;
+      RandomAccessIterator last = right;
+      while (cmp(*++first, pivot)) {}
+      if (first - 1 == left) {
+        while (first < last && !cmp(*--last, pivot)) {}
+      } else {
+        while (!cmp(*--last, pivot)) {}
+      }
+
+      if (first < last) {
+        std::iter_swap(first, last);
+        ++first;
+
+        unsigned char leftOffsets[partitionBlockSize];
+        unsigned char rightOffsets[partitionBlockSize];
+        RandomAccessIterator leftBase = first;
+        RandomAccessIterator rightBase = last;
+        std::size_t leftAmount = 0u;
+        std::size_t rightAmount = 0u;
+        std::size_t leftStart = 0u;
+        std::size_t rightStart = 0u;
+        while (first < last) {
+          std::size_t unknown = last - first;
+          std::size_t leftSplit = (leftAmount == 0u) ? ((rightAmount == 0u) ? unknown / 2 : unknown) : 0u;
+          std::size_t rightSplit = (rightAmount == 0u) ? unknown - leftSplit : 0u;
+          leftSplit = std::min(leftSplit, partitionBlockSize);
+          rightSplit = std::min(rightSplit, partitionBlockSize);
+
+          for (std::size_t i = 0u; i < leftSplit; ++i) {
+            leftOffsets[leftAmount] = static_cast< unsigned char >(i);
+            leftAmount += !cmp(*first, pivot);
+            ++first;
+          }
+          for (std::size_t i = 0u; i < rightSplit; ++i) {
+            rightOffsets[rightAmount] = static_cast< unsigned char >(i + 1);
+            rightAmount += cmp(*--last, pivot);
+          }
+
+          std::size_t amount = std::min(leftAmount, rightAmount);
+          swapOffsets(leftBase, rightBase, leftOffsets + leftStart, rightOffsets + rightStart, amount);
+          leftAmount -= amount;
+          rightAmount -= amount;
+          leftStart += amount;
+          rightStart += amount;
+          if (leftAmount == 0u) {
+            leftStart = 0u;
+            leftBase = first;
+          }
+          if (rightAmount == 0u) {
+            rightStart = 0u;
+            rightBase = last;
+          }
+        }
+
+        if (leftAmount != 0u) {
+          while (leftAmount-- != 0u) {
+            std::iter_swap(leftBase + leftOffsets[leftStart + leftAmount], --last);
+          }
+          first = last;
+        }
+        if (rightAmount != 0u) {
+          while (rightAmount-- != 0u) {
+            std::iter_swap(rightBase - rightOffsets[rightStart + rightAmount], first);
+            ++first;
+          }
+        }
+      }
+
+      RandomAccessIterator pivotPosition = first - 1;
+      std::iter_swap(left, pivotPosition);
+      return pivotPosition;
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    RandomAccessIterator partitionEqualsLeft(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      RandomAccessIterator first = left;
+      RandomAccessIterator last = right;
+      while (cmp(*left, *--last)) {}
+      if (last + 1 == right) {
+        while (first < last && !cmp(*left, *++first)) {}
+      } else {
+        while (!cmp(*left, *++first)) {}
+      }
+      while (first < last) {
+        std::iter_swap(first, last);
+        while (cmp(*left, *--last)) {}
+        while (!cmp(*left, *++first)) {}
+      }
+      std::iter_swap(left, last);
+      return last;
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    RandomAccessIterator partitionPivot(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+    {
+      if constexpr (isCheapCompare< RandomAccessIterator, Compare >()) {
+        return blockPartition(left, right, cmp);
+      } else {
+        return siobko::partition(left, right, cmp);
+      }
+    }
+
+    template< typename BidirectionalIterator, typename Compare >
+    BidirectionalIterator partition(BidirectionalIterator left, BidirectionalIterator right, Compare cmp,
+        std::bidirectional_iterator_tag)
+    {
+      BidirectionalIterator pivot = left;
+      BidirectionalIterator tmp = std::next(left);
+      for (BidirectionalIterator i = std::next(left); i != right; ++i) {
+        if (cmp((*i), (*pivot))) {
+          std::swap((*tmp++), (*i));
+        }
+      }
+      std::swap((*pivot), *(std::prev(tmp)));
+      return std::prev(tmp);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void introSort(RandomAccessIterator left, RandomAccessIterator right, std::size_t depthLimit, Compare cmp,
+        bool leftmost)
+    {
+      while (right - left > smallSortThreshold< RandomAccessIterator, Compare >()) {
+        if (depthLimit == 0u) {
+          heapSort(left, right, cmp);
+          return;
+        }
+        --depthLimit;
+
+        choosePivot(left, right, cmp);
+        if (!leftmost && !cmp(*(left - 1), *left)) {
+          left = partitionEqualsLeft(left, right, cmp) + 1;
+          continue;
+        }
+        RandomAccessIterator pivot = partitionPivot(left, right, cmp);
+        if (pivot - left < right - pivot) {
+          introSort(left, pivot, depthLimit, cmp, leftmost);
+          left = pivot + 1;
+          leftmost = false;
+        } else {
+          introSort(pivot + 1, right, depthLimit, cmp, false);
+          right = pivot;
+        }
+      }
+      smallSort(left, right, cmp);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void quickSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp, std::random_access_iterator_tag)
+    {
+      std::size_t depthLimit = 0u;
+      for (auto size = right - left; size > 1; size /= 2) {
+        depthLimit += 2u;
+      }
+      introSort(left, right, depthLimit, cmp, true);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void heapSelect(RandomAccessIterator left, RandomAccessIterator nth, RandomAccessIterator right, Compare cmp)
+    {
+      RandomAccessIterator middle = std::next(nth);
+      std::make_heap(left, middle, cmp);
+      for (RandomAccessIterator i = middle; i != right; ++i) {
+        if (cmp(*i, *left)) {
+          std::pop_heap(left, middle, cmp);
+          std::iter_swap(nth, i);
+          std::push_heap(left, middle, cmp);
+        }
+      }
+      std::iter_swap(left, nth);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void introSelect(RandomAccessIterator left, RandomAccessIterator nth, RandomAccessIterator right,
+        std::size_t depthLimit, Compare cmp)
+    {
+      while (right - left > insertionSortThreshold) {
+        if (depthLimit == 0u) {
+          heapSelect(left, nth, right, cmp);
+          return;
+        }
+        --depthLimit;
 
-    std::size_t bucketsAmount = size;
-    value_type min = *(std::min_element(container.begin(), container.end()));
-    value_type max = *(std::max_element(container.begin(), container.end()));
+        choosePivot(left, right, cmp);
+        RandomAccessIterator pivot = partitionPivot(left, right, cmp);
+        if (pivot == nth) {
+          return;
+        }
+        if (nth < pivot) {
+          right = pivot;
+        } else {
+          left = pivot + 1;
+        }
+      }
+      insertionSort(left, right, cmp);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void parallelIntroSort(RandomAccessIterator left, RandomAccessIterator right, std::size_t depthLimit, Compare cmp,
+        bool leftmost, std::ptrdiff_t grainSize, TaskGroup& group)
+    {
+      while (right - left > grainSize) {
+        if (depthLimit == 0u) {
+          heapSort(left, right, cmp);
+          return;
+        }
+        --depthLimit;
+
+        choosePivot(left, right, cmp);
+        if (!leftmost && !cmp(*(left - 1), *left)) {
+          left = partitionEqualsLeft(left, right, cmp) + 1;
+          continue;
+        }
+        RandomAccessIterator pivot = partitionPivot(left, right, cmp);
+        RandomAccessIterator middle = pivot + 1;
+        if (pivot - left < right - pivot) {
+          group.run([=, &group]() {
+            parallelIntroSort(left, pivot, depthLimit, cmp, leftmost, grainSize, group);
+          });
+          left = middle;
+          leftmost = false;
+        } else {
+          group.run([=, &group]() {
+            parallelIntroSort(middle, right, depthLimit, cmp, false, grainSize, group);
+          });
+          right = pivot;
+        }
+      }
+      introSort(left, right, depthLimit, cmp, leftmost);
+    }
+
+    template< typename InputIterator, typename OutputIterator, typename Compare >
+    void parallelMerge(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2,
+        OutputIterator out, Compare cmp, std::ptrdiff_t grainSize, ThreadPool& pool)
+    {
+      auto size1 = last1 - first1;
+      auto size2 = last2 - first2;
+      if (size1 + size2 <= grainSize) {
+        moveMerge(first1, last1, first2, last2, out, cmp);
+        return;
+      }
+
+      InputIterator middle1 = first1;
+      InputIterator middle2 = first2;
+      InputIterator next1 = first1;
+      InputIterator next2 = first2;
+      if (size1 >= size2) {
+        middle1 = first1 + size1 / 2;
+        middle2 = std::lower_bound(first2, last2, *middle1, cmp);
+        next1 = middle1 + 1;
+        next2 = middle2;
+        *(out + (middle1 - first1) + (middle2 - first2)) = std::move(*middle1);
+      } else {
+        middle2 = first2 + size2 / 2;
+        middle1 = std::upper_bound(first1, last1, *middle2, cmp);
+        next1 = middle1;
+        next2 = middle2 + 1;
+        *(out + (middle1 - first1) + (middle2 - first2)) = std::move(*middle2);
+      }
+      OutputIterator nextOut = out + (next1 - first1) + (next2 - first2);
 
-    double range = std::floor(max - min + 1);
-    std::vector< std::vector< value_type > > buckets(bucketsAmount);
-    for (auto& item: container) {
-      int i = std::floor(bucketsAmount * (item - min) / range);
-      buckets[i].push_back(item);
+      TaskGroup group(pool);
+      group.run([=, &pool]() {
+        parallelMerge(first1, middle1, first2, middle2, out, cmp, grainSize, pool);
+      });
+      parallelMerge(next1, last1, next2, last2, nextOut, cmp, grainSize, pool);
+      group.wait();
     }
-    for (auto& bucket: buckets) {
-      quickSort(bucket.begin(), bucket.end(), cmp);
+
+    template< typename RandomAccessIterator, typename BufferIterator, typename Compare >
+    void parallelMergeSort(RandomAccessIterator left, RandomAccessIterator right, BufferIterator buffer, Compare cmp,
+        std::ptrdiff_t grainSize, ThreadPool& pool)
+    {
+      auto size = right - left;
+      if (size <= grainSize) {
+        bottomUpMergeSort(left, right, buffer, cmp);
+        return;
+      }
+
+      RandomAccessIterator middle = left + size / 2;
+      BufferIterator bufferMiddle = buffer + size / 2;
+      {
+        TaskGroup group(pool);
+        group.run([=, &pool]() {
+          parallelMergeSort(left, middle, buffer, cmp, grainSize, pool);
+        });
+        parallelMergeSort(middle, right, bufferMiddle, cmp, grainSize, pool);
+        group.wait();
+      }
+      std::move(left, right, buffer);
+      parallelMerge(buffer, bufferMiddle, bufferMiddle, buffer + size, left, cmp, grainSize, pool);
     }
 
-    auto container_iterator = container.begin();
+    template< typename Ty, bool Floating = std::is_floating_point< Ty >::value >
+    struct RadixKey {
+      using type = std::make_unsigned_t< Ty >;
 
-    if (cmp(min, max)) {
-      for (auto it = buckets.begin(); it != buckets.end(); it++) {
-        for (auto bucketIt = it->begin(); bucketIt != it->end(); bucketIt++, container_iterator++) {
-          *container_iterator = *bucketIt;
+      static type get(Ty value)
+      {
+        type key = static_cast< type >(value);
+        if (std::is_signed< Ty >::value) {
+          key ^= type(1) << (sizeof(type) * 8 - 1);
         }
+        return key;
+      }
+    };
+
+    template< typename Ty >
+    struct RadixKey< Ty, true > {
+      using type = std::conditional_t< sizeof(Ty) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t >;
+      static_assert(sizeof(Ty) == sizeof(type), "radixSort supports 32- and 64-bit floating point types only.");
+
+      static type get(Ty value)
+      {
+        type bits = 0u;
+        std::memcpy(&bits, &value, sizeof(bits));
+        type sign = type(1) << (sizeof(type) * 8 - 1);
+        return (bits & sign) ? static_cast< type >(~bits) : (bits | sign);
+      }
+    };
+
+    template< bool Descending, typename Ty >
+    typename RadixKey< Ty >::type radixKey(Ty value)
+    {
+      using key_type = typename RadixKey< Ty >::type;
+      key_type key = RadixKey< Ty >::get(value);
+      return Descending ? static_cast< key_type >(~key) : key;
+    }
+
+    template< bool Descending, typename InputIterator, typename OutputIterator, typename Projection >
+    void radixScatter(InputIterator first, InputIterator last, OutputIterator out, std::size_t *offsets,
+        std::size_t shift, Projection proj)
+    {
+      for (; first != last; ++first) {
+        std::size_t digit = (radixKey< Descending >(proj(*first)) >> shift) & 0xFF;
+        *(out + offsets[digit]++) = std::move(*first);
+      }
+    }
+
+    template< bool Descending, typename RandomAccessIterator, typename Projection >
+    void radixSort(RandomAccessIterator left, RandomAccessIterator right, Projection proj)
+    {
+      using value_type = typename std::iterator_traits< RandomAccessIterator >::value_type;
+      using key_type = std::decay_t< decltype(proj(*left)) >;
+      constexpr std::size_t digits = sizeof(typename RadixKey< key_type >::type);
+      constexpr std::size_t radix = 256u;
+
+      std::size_t size = right - left;
+      if (size < 2u) {
+        return;
+      }
+
+      std::size_t counts[digits][radix] = {};
+      for (RandomAccessIterator it = left; it != right; ++it) {
+        auto key = radixKey< Descending >(proj(*it));
+        for (std::size_t digit = 0u; digit < digits; ++digit) {
+          ++counts[digit][(key >> (digit * 8)) & 0xFF];
+        }
+      }
+
+      auto firstKey = radixKey< Descending >(proj(*left));
+      std::vector< value_type > buffer(size);
+      bool inBuffer = false;
+      for (std::size_t digit = 0u; digit < digits; ++digit) {
+        std::size_t *count = counts[digit];
+        if (count[(firstKey >> (digit * 8)) & 0xFF] == size) {
+          continue;
+        }
+        std::size_t offset = 0u;
+        for (std::size_t i = 0u; i < radix; ++i) {
+          std::size_t amount = count[i];
+          count[i] = offset;
+          offset += amount;
+        }
+        if (inBuffer) {
+          radixScatter< Descending >(buffer.begin(), buffer.end(), left, count, digit * 8, proj);
+        } else {
+          radixScatter< Descending >(left, right, buffer.begin(), count, digit * 8, proj);
+        }
+        inBuffer = !inBuffer;
+      }
+      if (inBuffer) {
+        std::move(buffer.begin(), buffer.end(), left);
+      }
+    }
+
+    constexpr std::size_t bucketLoad = 4;
+    constexpr std::size_t sampleSortMaxBuckets = 256;
+    constexpr std::size_t sampleSortOversampling = 16;
+
+    template< typename Compare, typename Projection >
+    struct ProjectedCompare {
+      template< typename Lhs, typename Rhs >
+      bool operator()(const Lhs& lhs, const Rhs& rhs) const
+      {
+        return cmp_(proj_(lhs), proj_(rhs));
+      }
+
+      Compare cmp_;
+      Projection proj_;
+    };
+
+    template< typename Compare, typename Projection >
+    ProjectedCompare< Compare, Projection > projectCompare(Compare cmp, Projection proj)
+    {
+      return ProjectedCompare< Compare, Projection >{cmp, proj};
+    }
+
+    template< typename Compare >
+    Compare projectCompare(Compare cmp, Identity)
+    {
+      return cmp;
+    }
+
+    template< typename KeyIterator, typename ValueIterator >
+    void applyPermutation(std::vector< std::size_t >& order, KeyIterator keys, ValueIterator values)
+    {
+      for (std::size_t i = 0u; i < order.size(); ++i) {
+        if (order[i] == i) {
+          continue;
+        }
+        auto key = std::move(keys[i]);
+        auto value = std::move(values[i]);
+        std::size_t current = i;
+        while (order[current] != i) {
+          std::size_t next = order[current];
+          keys[current] = std::move(keys[next]);
+          values[current] = std::move(values[next]);
+          order[current] = current;
+          current = next;
+        }
+        keys[current] = std::move(key);
+        values[current] = std::move(value);
+        order[current] = current;
+      }
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void sortBuckets(RandomAccessIterator first, const std::vector< std::size_t >& ends, std::size_t fromBucket,
+        std::size_t toBucket, Compare cmp)
+    {
+      std::size_t begin = (fromBucket == 0u) ? 0u : ends[fromBucket - 1];
+      for (std::size_t bucket = fromBucket; bucket < toBucket; ++bucket) {
+        if (ends[bucket] - begin > 1u) {
+          siobko::quickSort(first + begin, first + ends[bucket], cmp);
+        }
+        begin = ends[bucket];
+      }
+    }
+
+    template< typename Function >
+    void runTasks(std::size_t amount, Function function, ThreadPool *pool)
+    {
+      if (pool == nullptr || amount < 2u) {
+        for (std::size_t i = 0u; i < amount; ++i) {
+          function(i);
+        }
+        return;
+      }
+      TaskGroup group(*pool);
+      for (std::size_t i = 1u; i < amount; ++i) {
+        group.run([&function, i]() {
+          function(i);
+        });
+      }
+      function(0u);
+      group.wait();
+    }
+
+    template< typename Ty >
+    void buildSplitterTree(const std::vector< Ty >& splitters, std::vector< Ty >& tree, std::size_t node,
+        std::size_t& next)
+    {
+      if (node >= tree.size()) {
+        return;
+      }
+      buildSplitterTree(splitters, tree, 2 * node, next);
+      tree[node] = splitters[next++];
+      buildSplitterTree(splitters, tree, 2 * node + 1, next);
+    }
+
+    template< typename RandomAccessIterator, typename Compare >
+    void sampleSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp, std::size_t grainSize,
+        std::size_t chunksAmount, ThreadPool *pool)
+    {
+      using value_type = typename std::iterator_traits< RandomAccessIterator >::value_type;
+
+      std::size_t size = right - left;
+      std::size_t bucketsAmount = 2u;
+      std::size_t levels = 1u;
+      while (bucketsAmount < sampleSortMaxBuckets && bucketsAmount * 2 * grainSize <= size) {
+        bucketsAmount *= 2;
+        ++levels;
+      }
+      if (size < 2 * grainSize || size < bucketsAmount * sampleSortOversampling) {
+        siobko::quickSort(left, right, cmp);
+        return;
+      }
+
+      std::vector< value_type > sample;
+      sample.reserve(bucketsAmount * sampleSortOversampling);
+      std::uint64_t state = size;
+      for (std::size_t i = 0u; i < bucketsAmount * sampleSortOversampling; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        sample.push_back(*(left + (state >> 11) % size));
+      }
+      siobko::quickSort(sample.begin(), sample.end(), cmp);
+      std::vector< value_type > splitters;
+      splitters.reserve(bucketsAmount - 1);
+      for (std::size_t i = 1u; i < bucketsAmount; ++i) {
+        splitters.push_back(sample[i * sampleSortOversampling]);
+      }
+      std::vector< value_type > tree(bucketsAmount);
+      std::size_t next = 0u;
+      buildSplitterTree(splitters, tree, 1u, next);
+
+      std::size_t chunkSize = (size + chunksAmount - 1) / chunksAmount;
+      std::vector< std::uint8_t > bucketIds(size);
+      std::vector< std::size_t > counts(chunksAmount * bucketsAmount, 0u);
+      runTasks(chunksAmount, [&](std::size_t chunk) {
+        std::size_t begin = std::min(size, chunk * chunkSize);
+        std::size_t end = std::min(size, begin + chunkSize);
+        std::size_t *count = counts.data() + chunk * bucketsAmount;
+        for (std::size_t i = begin; i < end; ++i) {
+          const value_type& value = *(left + i);
+          std::size_t node = 1u;
+          for (std::size_t level = 0u; level < levels; ++level) {
+            node = 2 * node + static_cast< std::size_t >(cmp(tree[node], value));
+          }
+          std::size_t bucket = node - bucketsAmount;
+          bucketIds[i] = static_cast< std::uint8_t >(bucket);
+          ++count[bucket];
+        }
+      }, pool);
+
+      std::vector< std::size_t > bucketEnds(bucketsAmount);
+      std::size_t offset = 0u;
+      for (std::size_t bucket = 0u; bucket < bucketsAmount; ++bucket) {
+        for (std::size_t chunk = 0u; chunk < chunksAmount; ++chunk) {
+          std::size_t amount = counts[chunk * bucketsAmount + bucket];
+          counts[chunk * bucketsAmount + bucket] = offset;
+          offset += amount;
+        }
+        bucketEnds[bucket] = offset;
+      }
+
+      std::vector< value_type > buffer(size);
+      runTasks(chunksAmount, [&](std::size_t chunk) {
+        std::size_t begin = std::min(size, chunk * chunkSize);
+        std::size_t end = std::min(size, begin + chunkSize);
+        std::size_t *position = counts.data() + chunk * bucketsAmount;
+        for (std::size_t i = begin; i < end; ++i) {
+          buffer[position[bucketIds[i]]++] = std::move(*(left + i));
+        }
+      }, pool);
+
+      runTasks(bucketsAmount, [&](std::size_t bucket) {
+        std::size_t begin = (bucket == 0u) ? 0u : bucketEnds[bucket - 1];
+        std::size_t end = bucketEnds[bucket];
+        siobko::quickSort(buffer.begin() + begin, buffer.begin() + end, cmp);
+        std::move(buffer.begin() + begin, buffer.begin() + end, left + begin);
+      }, pool);
+    }
+
+    template< typename Container, typename Compare, typename Projection, typename BucketsSorter >
+    void flatBucketSort(Container& container, std::size_t maxBuckets, Compare cmp, Projection proj,
+        BucketsSorter sorter)
+    {
+      using value_type = typename Container::value_type;
+      using key_type = std::decay_t< decltype(proj(std::declval< const value_type& >())) >;
+      static_assert(std::is_arithmetic< key_type >::value, "bucketSort needs an arithmetic sort key.");
+
+      if (container.begin() == container.end()) {
+        return;
+      }
+      std::size_t size = 0u;
+      key_type min = proj(*container.begin());
+      key_type max = min;
+      for (const auto& item: container) {
+        key_type key = proj(item);
+        min = (key < min) ? key : min;
+        max = (max < key) ? key : max;
+        ++size;
+      }
+      if (!(min < max)) {
+        return;
+      }
+
+      bool descending = cmp(max, min);
+      std::size_t bucketsAmount = std::max< std::size_t >(1u, std::min(maxBuckets, size / bucketLoad));
+      bool exact = false;
+      if constexpr (std::is_integral< key_type >::value) {
+        std::uint64_t spread = static_cast< std::uint64_t >(max) - static_cast< std::uint64_t >(min);
+        if (spread < std::min(maxBuckets, size)) {
+          bucketsAmount = spread + 1;
+          exact = true;
+        }
+      }
+      double range = static_cast< double >(max) - static_cast< double >(min);
+      double scale = (range > 0.0) ? bucketsAmount / range : 0.0;
+
+      auto bucketOf = [&](const value_type& item) {
+        key_type key = proj(item);
+        std::size_t index = 0u;
+        if constexpr (std::is_integral< key_type >::value) {
+          if (exact) {
+            index = static_cast< std::uint64_t >(key) - static_cast< std::uint64_t >(min);
+            return descending ? bucketsAmount - 1 - index : index;
+          }
+        }
+        double offset = (static_cast< double >(key) - static_cast< double >(min)) * scale;
+        index = std::min(bucketsAmount - 1, static_cast< std::size_t >(offset));
+        return descending ? bucketsAmount - 1 - index : index;
+      };
+
+      std::vector< std::size_t > ends(bucketsAmount + 1, 0u);
+      for (const auto& item: container) {
+        ++ends[bucketOf(item) + 1];
       }
+      for (std::size_t i = 1u; i <= bucketsAmount; ++i) {
+        ends[i] += ends[i - 1];
+      }
+      std::vector< value_type > buffer(size);
+      for (auto& item: container) {
+        buffer[ends[bucketOf(item)]++] = std::move(item);
+      }
+      ends.pop_back();
+
+      if (!exact) {
+        sorter(buffer.begin(), ends, projectCompare(cmp, proj));
+      }
+      std::move(buffer.begin(), buffer.end(), container.begin());
+    }
+  }
+
+  template< typename Container, typename Compare >
+  void bucketSort(Container& container, std::size_t size, Compare cmp)
+  {
+    bucketSort(container, size, cmp, Identity());
+  }
+
+  template< typename Container, typename Compare, typename Projection >
+  void bucketSort(Container& container, std::size_t size, Compare cmp, Projection proj)
+  {
+    detail::flatBucketSort(container, size, cmp, proj, [](auto first, const auto& ends, auto compare) {
+      detail::sortBuckets(first, ends, 0u, ends.size(), compare);
+    });
+  }
+
+  template< typename Container, typename Compare >
+  void bucketSort(ExecutionPolicy policy, Container& container, std::size_t size, Compare cmp,
+      std::size_t grainSize, ThreadPool& pool)
+  {
+    if (policy == ExecutionPolicy::SEQUENTIAL) {
+      bucketSort(container, size, cmp);
       return;
     }
-    for (auto it = buckets.rbegin(); it != buckets.rend(); it++) {
-      for (auto bucketIt = it->begin(); bucketIt != it->end(); bucketIt++, container_iterator++) {
-        *container_iterator = *bucketIt;
+
+    detail::flatBucketSort(container, size, cmp, Identity(), [grainSize, &pool](auto first, const auto& ends,
+        auto compare) {
+      TaskGroup group(pool);
+      std::size_t fromBucket = 0u;
+      std::size_t batchStart = 0u;
+      for (std::size_t bucket = 0u; bucket < ends.size(); ++bucket) {
+        if (ends[bucket] - batchStart >= grainSize || bucket + 1 == ends.size()) {
+          group.run([first, &ends, fromBucket, bucket, compare]() {
+            detail::sortBuckets(first, ends, fromBucket, bucket + 1, compare);
+          });
+          fromBucket = bucket + 1;
+          batchStart = ends[bucket];
+        }
       }
+      group.wait();
+    });
+  }
+
+  template< typename ForwardIterator, typename Compare >
+  void mergeSort(ForwardIterator left, ForwardIterator right, Compare cmp)
+  {
+    using category = typename std::iterator_traits< ForwardIterator >::iterator_category;
+    detail::sortRange(left, right, [cmp](auto first, auto last) {
+      detail::mergeSort(first, last, cmp, std::random_access_iterator_tag());
+    }, category());
+  }
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void mergeSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj)
+  {
+    mergeSort(left, right, detail::projectCompare(cmp, proj));
+  }
+
+  template< typename RandomAccessIterator, typename Compare >
+  void mergeSort(ExecutionPolicy policy, RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      std::size_t grainSize, ThreadPool& pool)
+  {
+    if (policy == ExecutionPolicy::SEQUENTIAL) {
+      mergeSort(left, right, cmp);
+      return;
     }
+
+    std::vector< typename std::iterator_traits< RandomAccessIterator >::value_type > buffer(left, right);
+    auto grain = std::max< std::ptrdiff_t >(grainSize, 1);
+    detail::parallelMergeSort(left, right, buffer.begin(), cmp, grain, pool);
+  }
+
+  template< typename ForwardIterator, typename Compare >
+  void timSort(ForwardIterator left, ForwardIterator right, Compare cmp)
+  {
+    using category = typename std::iterator_traits< ForwardIterator >::iterator_category;
+    detail::sortRange(left, right, [cmp](auto first, auto last) {
+      detail::timSort(first, last, cmp, std::random_access_iterator_tag());
+    }, category());
+  }
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void timSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj)
+  {
+    timSort(left, right, detail::projectCompare(cmp, proj));
+  }
+
+  template< typename ForwardIterator, typename Compare >
+  void quickSort(ForwardIterator left, ForwardIterator right, Compare cmp)
+  {
+    using category = typename std::iterator_traits< ForwardIterator >::iterator_category;
+    detail::sortRange(left, right, [cmp](auto first, auto last) {
+      detail::quickSort(first, last, cmp, std::random_access_iterator_tag());
+    }, category());
+  }
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void quickSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj)
+  {
+    quickSort(left, right, detail::projectCompare(cmp, proj));
   }
 
   template< typename RandomAccessIterator, typename Compare >
-  void mergeSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+  void quickSort(ExecutionPolicy policy, RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      std::size_t grainSize, ThreadPool& pool)
   {
-    if (right - left > 1) {
-      RandomAccessIterator middle = left + (right - left) / 2;
-      mergeSort(left, middle, cmp);
-      mergeSort(middle, right, cmp);
-      std::inplace_merge(left, middle, right, cmp);
+    if (policy == ExecutionPolicy::SEQUENTIAL) {
+      quickSort(left, right, cmp);
+      return;
     }
+
+    std::size_t depthLimit = 0u;
+    for (auto size = right - left; size > 1; size /= 2) {
+      depthLimit += 2u;
+    }
+    TaskGroup group(pool);
+    auto grain = std::max< std::ptrdiff_t >(grainSize, detail::insertionSortThreshold);
+    detail::parallelIntroSort(left, right, depthLimit, cmp, true, grain, group);
+    group.wait();
+  }
+
+  template< typename ForwardIterator, typename Compare >
+  void sampleSort(ForwardIterator left, ForwardIterator right, Compare cmp)
+  {
+    using category = typename std::iterator_traits< ForwardIterator >::iterator_category;
+    detail::sortRange(left, right, [cmp](auto first, auto last) {
+      detail::sampleSort(first, last, cmp, defaultGrainSize, 1u, nullptr);
+    }, category());
+  }
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void sampleSort(ForwardIterator left, ForwardIterator right, Compare cmp, Projection proj)
+  {
+    sampleSort(left, right, detail::projectCompare(cmp, proj));
   }
 
   template< typename RandomAccessIterator, typename Compare >
-  void quickSort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+  void sampleSort(ExecutionPolicy policy, RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      std::size_t grainSize, ThreadPool& pool)
   {
-    if (std::distance(left, right) < 2) {
+    if (policy == ExecutionPolicy::SEQUENTIAL) {
+      sampleSort(left, right, cmp);
       return;
     }
 
-    RandomAccessIterator pivot = siobko::partition(left, right, cmp);
-    quickSort(left, pivot, cmp);
-    quickSort(std::next(pivot), right, cmp);
+    std::size_t grain = std::max< std::size_t >(grainSize, 1u);
+    std::size_t chunksAmount = std::max< std::size_t >(1u, std::min< std::size_t >((right - left) / grain,
+        4 * (pool.size() + 1)));
+    detail::sampleSort(left, right, cmp, grain, chunksAmount, &pool);
+  }
+
+  template< typename ForwardIterator, typename Compare >
+  void radixSort(ForwardIterator left, ForwardIterator right, Compare cmp)
+  {
+    radixSort(left, right, cmp, Identity());
+  }
+
+  template< typename ForwardIterator, typename Compare, typename Projection >
+  void radixSort(ForwardIterator left, ForwardIterator right, Compare, Projection proj)
+  {
+    using key_type = std::decay_t< decltype(proj(*left)) >;
+    using order = CompareOrder< key_type, Compare >;
+    static_assert(std::is_arithmetic< key_type >::value && !std::is_same< key_type, bool >::value,
+        "radixSort supports integral and floating point keys only.");
+    static_assert(order::known, "radixSort supports std::less and std::greater only.");
+    using category = typename std::iterator_traits< ForwardIterator >::iterator_category;
+    detail::sortRange(left, right, [proj](auto first, auto last) {
+      detail::radixSort< order::descending >(first, last, proj);
+    }, category());
   }
 
   template< typename RandomAccessIterator, typename Compare >
-  RandomAccessIterator partition(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+  std::vector< std::size_t > argsort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+  {
+    return argsort(left, right, cmp, Identity());
+  }
+
+  template< typename RandomAccessIterator, typename Compare, typename Projection >
+  std::vector< std::size_t > argsort(RandomAccessIterator left, RandomAccessIterator right, Compare cmp,
+      Projection proj)
+  {
+    std::vector< std::size_t > order(right - left);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    timSort(order.begin(), order.end(), [left, cmp, proj](std::size_t lhs, std::size_t rhs) {
+      return cmp(proj(left[lhs]), proj(left[rhs]));
+    });
+    return order;
+  }
+
+  template< typename KeyIterator, typename ValueIterator, typename Compare >
+  void coSort(KeyIterator keysLeft, KeyIterator keysRight, ValueIterator values, Compare cmp)
+  {
+    coSort(keysLeft, keysRight, values, cmp, Identity());
+  }
+
+  template< typename KeyIterator, typename ValueIterator, typename Compare, typename Projection >
+  void coSort(KeyIterator keysLeft, KeyIterator keysRight, ValueIterator values, Compare cmp, Projection proj)
+  {
+    std::vector< std::size_t > order = argsort(keysLeft, keysRight, cmp, proj);
+    detail::applyPermutation(order, keysLeft, values);
+  }
+
+  template< typename RandomAccessIterator, typename Compare >
+  void nthElement(RandomAccessIterator left, RandomAccessIterator nth, RandomAccessIterator right, Compare cmp)
+  {
+    if (nth == right) {
+      return;
+    }
+    std::size_t depthLimit = 0u;
+    for (auto size = right - left; size > 1; size /= 2) {
+      depthLimit += 2u;
+    }
+    detail::introSelect(left, nth, right, depthLimit, cmp);
+  }
+
+  template< typename RandomAccessIterator, typename Compare >
+  void partialSort(RandomAccessIterator left, RandomAccessIterator middle, RandomAccessIterator right, Compare cmp)
+  {
+    nthElement(left, middle, right, cmp);
+    quickSort(left, middle, cmp);
+  }
+
+  template< typename InputIterator, typename Compare >
+  std::vector< typename std::iterator_traits< InputIterator >::value_type > topK(InputIterator first,
+      InputIterator last, std::size_t k, Compare cmp)
   {
-    RandomAccessIterator pivot = left;
-    RandomAccessIterator tmp = std::next(left);
-    for (RandomAccessIterator i = std::next(left); i != right; ++i) {
-      if (cmp((*i), (*pivot))) {
-        std::swap((*tmp++), (*i));
+    std::vector< typename std::iterator_traits< InputIterator >::value_type > heap;
+    if (k == 0u) {
+      return heap;
+    }
+    for (; first != last; ++first) {
+      if (heap.size() < k) {
+        heap.push_back(*first);
+        std::push_heap(heap.begin(), heap.end(), cmp);
+      } else if (cmp(*first, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), cmp);
+        heap.back() = *first;
+        std::push_heap(heap.begin(), heap.end(), cmp);
       }
     }
-    std::swap((*pivot), *(std::prev(tmp)));
-    return prev(tmp);
+    std::sort_heap(heap.begin(), heap.end(), cmp);
+    return heap;
+  }
+
+  template< typename RandomAccessIterator, typename Compare >
+  RandomAccessIterator partition(RandomAccessIterator left, RandomAccessIterator right, Compare cmp)
+  {
+    using category = typename std::iterator_traits< RandomAccessIterator >::iterator_category;
+    return detail::partition(left, right, cmp, category());
   }
 
   template< typename RandomAccessIterator, typename Compare >
   void merge(RandomAccessIterator left, RandomAccessIterator middle, RandomAccessIterator right, Compare cmp)
   {
-    std::vector< typename RandomAccessIterator::value_type > result(std::distance(left, right));
+    std::vector< typename std::iterator_traits< RandomAccessIterator >::value_type > result;
+    result.reserve(right - left);
+    detail::moveMerge(left, middle, middle, right, std::back_inserter(result), cmp);
+    std::move(result.begin(), result.end(), left);
+  }
 
-    auto leftIt = left;
-    auto rightIt = middle;
+  template< typename RangeIterator, typename OutputIterator, typename Compare >
+  OutputIterator kWayMerge(RangeIterator firstRange, RangeIterator lastRange, OutputIterator out, Compare cmp)
+  {
+    using input_iterator = decltype(std::begin(*firstRange));
+    using value_type = typename std::iterator_traits< input_iterator >::value_type;
 
-    while (leftIt != middle && rightIt != right) {
-      result.push_back(cmp(*leftIt, *rightIt) ? std::move(*leftIt++) : std::move(*rightIt++));
+    std::vector< detail::RangeSource< input_iterator > > sources;
+    for (; firstRange != lastRange; ++firstRange) {
+      sources.push_back({std::begin(*firstRange), std::end(*firstRange)});
     }
-
-    result.insert(result.end(), std::make_move_iterator(leftIt), std::make_move_iterator(middle));
-    result.insert(result.end(), std::make_move_iterator(rightIt), std::make_move_iterator(right));
-    std::move(result.begin(), result.end(), left);
+    detail::loserTreeMerge< value_type >(sources, [&out](value_type&& value) {
+      *out = std::move(value);
+      ++out;
+    }, cmp);
+    return out;
   }
 }
 #endif
@@ -5,10 +5,10 @@
 #include "ForwardList.h"
 
 namespace siobko {
-  template< typename Ty >
+  template< typename Ty, typename Storage = ForwardList< Ty > >
   class Stack {
   public:
-    using storage_t = ForwardList< Ty >;
+    using storage_t = Storage;
     using iterator = typename storage_t::iterator;
     using const_iterator = typename storage_t::const_iterator;
     using reference = Ty&;
@@ -40,89 +40,89 @@ namespace siobko {
     storage_t storage_;
   };
 
-  template< typename Ty >
-  Stack< Ty >::Stack(const Stack& rhs):
+  template< typename Ty, typename Storage >
+  Stack< Ty, Storage >::Stack(const Stack& rhs):
     storage_(rhs.storage_)
   {}
 
-  template< typename Ty >
-  Stack< Ty >::Stack(Stack&& rhs) noexcept:
-    storage_(rhs.storage_)
+  template< typename Ty, typename Storage >
+  Stack< Ty, Storage >::Stack(Stack&& rhs) noexcept:
+    storage_(std::move(rhs.storage_))
   {}
 
-  template< typename Ty >
-  Stack< Ty >::Stack(std::initializer_list< value_type > IList):
+  template< typename Ty, typename Storage >
+  Stack< Ty, Storage >::Stack(std::initializer_list< value_type > IList):
     storage_(IList)
   {}
 
-  template< typename Ty >
-  Stack< Ty >::~Stack()
+  template< typename Ty, typename Storage >
+  Stack< Ty, Storage >::~Stack()
   {
     clear();
   }
 
-  template< typename Ty >
-  typename Stack< Ty >::iterator Stack< Ty >::begin() noexcept
+  template< typename Ty, typename Storage >
+  typename Stack< Ty, Storage >::iterator Stack< Ty, Storage >::begin() noexcept
   {
     return storage_.begin();
   }
 
-  template< typename Ty >
-  typename Stack< Ty >::iterator Stack< Ty >::end() noexcept
+  template< typename Ty, typename Storage >
+  typename Stack< Ty, Storage >::iterator Stack< Ty, Storage >::end() noexcept
   {
     return storage_.end();
   }
 
-  template< typename Ty >
-  typename Stack< Ty >::const_iterator Stack< Ty >::begin() const noexcept
+  template< typename Ty, typename Storage >
+  typename Stack< Ty, Storage >::const_iterator Stack< Ty, Storage >::begin() const noexcept
   {
     return storage_.cbegin();
   }
 
-  template< typename Ty >
-  typename Stack< Ty >::const_iterator Stack< Ty >::end() const noexcept
+  template< typename Ty, typename Storage >
+  typename Stack< Ty, Storage >::const_iterator Stack< Ty, Storage >::end() const noexcept
   {
     return storage_.cend();
   }
 
-  template< typename Ty >
-  typename Stack< Ty >::reference Stack< Ty >::front() noexcept
+  template< typename Ty, typename Storage >
+  typename Stack< Ty, Storage >::reference Stack< Ty, Storage >::front() noexcept
   {
     return storage_.front();
   }
 
-  template< typename Ty >
-  typename Stack< Ty >::const_reference Stack< Ty >::front() const noexcept
+  template< typename Ty, typename Storage >
+  typename Stack< Ty, Storage >::const_reference Stack< Ty, Storage >::front() const noexcept
   {
     return storage_.front();
   }
 
-  template< typename Ty >
-  typename Stack< Ty >::size_type Stack< Ty >::size() const noexcept
+  template< typename Ty, typename Storage >
+  typename Stack< Ty, Storage >::size_type Stack< Ty, Storage >::size() const noexcept
   {
     return storage_.size();
   }
 
-  template< typename Ty >
-  bool Stack< Ty >::is_empty() const noexcept
+  template< typename Ty, typename Storage >
+  bool Stack< Ty, Storage >::is_empty() const noexcept
   {
     return storage_.is_empty();
   }
 
-  template< typename Ty >
-  void Stack< Ty >::push(const Ty& obj)
+  template< typename Ty, typename Storage >
+  void Stack< Ty, Storage >::push(const Ty& obj)
   {
     storage_.push_front(obj);
   }
 
-  template< typename Ty >
-  void Stack< Ty >::pop()
+  template< typename Ty, typename Storage >
+  void Stack< Ty, Storage >::pop()
   {
     storage_.pop_front();
   }
 
-  template< typename Ty >
-  void Stack< Ty >::clear()
+  template< typename Ty, typename Storage >
+  void Stack< Ty, Storage >::clear()
   {
     storage_.clear();
   }
@@ -0,0 +1,426 @@
+#ifndef STACK_BUFFER_H
+#define STACK_BUFFER_H
+
+#include <stdexcept>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <new>
+
+namespace siobko {
+  template< class Ty, std::size_t InlineCapacity = 16 >
+  class StackBuffer {
+    static_assert(InlineCapacity > 0, "StackBuffer must have inline capacity");
+
+  public:
+    struct ConstIterator;
+    struct Iterator;
+
+  public:
+    using size_type = std::size_t;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reference = Ty&;
+    using const_reference = const Ty&;
+    using value_type = Ty;
+
+    StackBuffer();
+    StackBuffer(const StackBuffer& rhs);
+    StackBuffer(StackBuffer&& rhs) noexcept;
+    StackBuffer(std::initializer_list< value_type > IList);
+    ~StackBuffer();
+
+    StackBuffer& operator=(const StackBuffer& other);
+    StackBuffer& operator=(StackBuffer&& other) noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    reference front() noexcept;
+    const_reference front() const noexcept;
+
+    void push_front(const Ty& val);
+    void emplace_front(const Ty& val);
+    void pop_front();
+    void reserve(size_type capacity);
+    bool is_empty() const noexcept;
+    bool is_inline() const noexcept;
+    void clear() noexcept;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+
+  private:
+    Ty *inline_data() noexcept;
+    void steal(StackBuffer& other) noexcept;
+    void release() noexcept;
+
+    Ty *data_;
+    size_type size_;
+    size_type capacity_;
+    alignas(Ty) unsigned char inline_[InlineCapacity * sizeof(Ty)];
+  };
+
+  template< class Ty, std::size_t InlineCapacity >
+  struct StackBuffer< Ty, InlineCapacity >::ConstIterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Ty&;
+    using const_reference = const Ty&;
+    using pointer = const Ty *;
+
+    ConstIterator() = default;
+    explicit ConstIterator(const Ty *past);
+    ~ConstIterator() = default;
+
+    const_reference operator*() const noexcept;
+    pointer operator->() const noexcept;
+    ConstIterator& operator++();
+    ConstIterator operator++(int);
+    bool operator!=(const ConstIterator& other) const noexcept;
+    bool operator==(const ConstIterator& other) const noexcept;
+
+    const Ty *past_;
+  };
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >::ConstIterator::ConstIterator(const Ty *past):
+    past_(past)
+  {}
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::ConstIterator::const_reference
+  StackBuffer< Ty, InlineCapacity >::ConstIterator::operator*() const noexcept
+  {
+    return *(past_ - 1);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::ConstIterator::pointer
+  StackBuffer< Ty, InlineCapacity >::ConstIterator::operator->() const noexcept
+  {
+    return past_ - 1;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::ConstIterator& StackBuffer< Ty, InlineCapacity >::ConstIterator::operator++()
+  {
+    --past_;
+    return *this;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::ConstIterator StackBuffer< Ty, InlineCapacity >::ConstIterator::operator++(int)
+  {
+    ConstIterator was(past_);
+    ++(*this);
+    return was;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  bool StackBuffer< Ty, InlineCapacity >::ConstIterator::operator==(const ConstIterator& other) const noexcept
+  {
+    return past_ == other.past_;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  bool StackBuffer< Ty, InlineCapacity >::ConstIterator::operator!=(const ConstIterator& other) const noexcept
+  {
+    return past_ != other.past_;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  struct StackBuffer< Ty, InlineCapacity >::Iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Ty;
+    using difference_type = std::ptrdiff_t;
+    using reference = Ty&;
+    using pointer = Ty *;
+
+    Iterator() = default;
+    explicit Iterator(Ty *past);
+    ~Iterator() = default;
+
+    reference operator*() const noexcept;
+    pointer operator->() const noexcept;
+    Iterator& operator++();
+    Iterator operator++(int);
+    bool operator!=(const Iterator& other) const noexcept;
+    bool operator==(const Iterator& other) const noexcept;
+
+    Ty *past_;
+  };
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >::Iterator::Iterator(Ty *past):
+    past_(past)
+  {}
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::Iterator::reference
+  StackBuffer< Ty, InlineCapacity >::Iterator::operator*() const noexcept
+  {
+    return *(past_ - 1);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::Iterator::pointer
+  StackBuffer< Ty, InlineCapacity >::Iterator::operator->() const noexcept
+  {
+    return past_ - 1;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::Iterator& StackBuffer< Ty, InlineCapacity >::Iterator::operator++()
+  {
+    --past_;
+    return *this;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::Iterator StackBuffer< Ty, InlineCapacity >::Iterator::operator++(int)
+  {
+    Iterator was(past_);
+    ++(*this);
+    return was;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  bool StackBuffer< Ty, InlineCapacity >::Iterator::operator==(const Iterator& other) const noexcept
+  {
+    return past_ == other.past_;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  bool StackBuffer< Ty, InlineCapacity >::Iterator::operator!=(const Iterator& other) const noexcept
+  {
+    return past_ != other.past_;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >::StackBuffer():
+    data_(inline_data()),
+    size_(0u),
+    capacity_(InlineCapacity)
+  {}
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >::StackBuffer(const StackBuffer& rhs):
+    StackBuffer()
+  {
+    reserve(rhs.size_);
+    for (size_type i = 0u; i < rhs.size_; ++i) {
+      new (data_ + i) Ty(rhs.data_[i]);
+      ++size_;
+    }
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >::StackBuffer(StackBuffer&& rhs) noexcept:
+    StackBuffer()
+  {
+    steal(rhs);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >::StackBuffer(std::initializer_list< value_type > IList):
+    StackBuffer()
+  {
+    reserve(IList.size());
+    for (auto it = IList.end(); it != IList.begin();) {
+      push_front(*--it);
+    }
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >::~StackBuffer()
+  {
+    release();
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >& StackBuffer< Ty, InlineCapacity >::operator=(const StackBuffer& other)
+  {
+    if (this != &other) {
+      (*this) = StackBuffer(other);
+    }
+    return *this;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  StackBuffer< Ty, InlineCapacity >& StackBuffer< Ty, InlineCapacity >::operator=(StackBuffer&& other) noexcept
+  {
+    if (this != &other) {
+      release();
+      steal(other);
+    }
+    return *this;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::iterator StackBuffer< Ty, InlineCapacity >::begin() noexcept
+  {
+    return iterator(data_ + size_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::iterator StackBuffer< Ty, InlineCapacity >::end() noexcept
+  {
+    return iterator(data_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::const_iterator StackBuffer< Ty, InlineCapacity >::begin() const noexcept
+  {
+    return const_iterator(data_ + size_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::const_iterator StackBuffer< Ty, InlineCapacity >::end() const noexcept
+  {
+    return const_iterator(data_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::const_iterator StackBuffer< Ty, InlineCapacity >::cbegin() const noexcept
+  {
+    return const_iterator(data_ + size_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::const_iterator StackBuffer< Ty, InlineCapacity >::cend() const noexcept
+  {
+    return const_iterator(data_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::reference StackBuffer< Ty, InlineCapacity >::front() noexcept
+  {
+    return data_[size_ - 1];
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::const_reference StackBuffer< Ty, InlineCapacity >::front() const noexcept
+  {
+    return data_[size_ - 1];
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  void StackBuffer< Ty, InlineCapacity >::push_front(const Ty& val)
+  {
+    if (size_ == capacity_) {
+      Ty copy(val);
+      reserve(capacity_ * 2);
+      new (data_ + size_) Ty(std::move(copy));
+    } else {
+      new (data_ + size_) Ty(val);
+    }
+    ++size_;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  void StackBuffer< Ty, InlineCapacity >::emplace_front(const Ty& val)
+  {
+    push_front(val);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  void StackBuffer< Ty, InlineCapacity >::pop_front()
+  {
+    if (is_empty()) {
+      throw std::logic_error("StackBuffer pop front error: StackBuffer is empty.");
+    }
+    data_[--size_].~Ty();
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  void StackBuffer< Ty, InlineCapacity >::reserve(size_type capacity)
+  {
+    if (capacity <= capacity_) {
+      return;
+    }
+    Ty *data = static_cast< Ty * >(::operator new(capacity * sizeof(Ty), std::align_val_t(alignof(Ty))));
+    for (size_type i = 0u; i < size_; ++i) {
+      new (data + i) Ty(std::move(data_[i]));
+      data_[i].~Ty();
+    }
+    if (!is_inline()) {
+      ::operator delete(data_, std::align_val_t(alignof(Ty)));
+    }
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  bool StackBuffer< Ty, InlineCapacity >::is_empty() const noexcept
+  {
+    return size_ == 0u;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  bool StackBuffer< Ty, InlineCapacity >::is_inline() const noexcept
+  {
+    return data_ == reinterpret_cast< const Ty * >(inline_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  void StackBuffer< Ty, InlineCapacity >::clear() noexcept
+  {
+    while (size_ != 0u) {
+      data_[--size_].~Ty();
+    }
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::size_type StackBuffer< Ty, InlineCapacity >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  typename StackBuffer< Ty, InlineCapacity >::size_type StackBuffer< Ty, InlineCapacity >::capacity() const noexcept
+  {
+    return capacity_;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  Ty *StackBuffer< Ty, InlineCapacity >::inline_data() noexcept
+  {
+    return reinterpret_cast< Ty * >(inline_);
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  void StackBuffer< Ty, InlineCapacity >::steal(StackBuffer& other) noexcept
+  {
+    if (other.is_inline()) {
+      for (size_type i = 0u; i < other.size_; ++i) {
+        new (data_ + i) Ty(std::move(other.data_[i]));
+      }
+      size_ = other.size_;
+      other.clear();
+      return;
+    }
+    data_ = other.data_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.data_ = other.inline_data();
+    other.size_ = 0u;
+    other.capacity_ = InlineCapacity;
+  }
+
+  template< class Ty, std::size_t InlineCapacity >
+  void StackBuffer< Ty, InlineCapacity >::release() noexcept
+  {
+    clear();
+    if (!is_inline()) {
+      ::operator delete(data_, std::align_val_t(alignof(Ty)));
+    }
+    data_ = inline_data();
+    capacity_ = InlineCapacity;
+  }
+}
+#endif
@@ -0,0 +1,146 @@
+#include "ThreadPool.h"
+
+namespace siobko {
+  namespace {
+    thread_local ThreadPool *currentPool = nullptr;
+    thread_local std::size_t currentQueue = 0u;
+  }
+
+  ThreadPool::ThreadPool(std::size_t threadsAmount):
+    pending_(0u),
+    stopping_(false)
+  {
+    for (std::size_t i = 0u; i <= threadsAmount; ++i) {
+      queues_.push_back(std::make_unique< WorkQueue >());
+    }
+    for (std::size_t i = 0u; i < threadsAmount; ++i) {
+      threads_.emplace_back(&ThreadPool::run, this, i);
+    }
+  }
+
+  ThreadPool::~ThreadPool()
+  {
+    {
+      std::lock_guard< std::mutex > lock(sleepMutex_);
+      stopping_ = true;
+    }
+    wakeUp_.notify_all();
+    for (std::thread& thread: threads_) {
+      thread.join();
+    }
+  }
+
+  void ThreadPool::submit(task_t task)
+  {
+    std::size_t index = (currentPool == this) ? currentQueue : threads_.size();
+    {
+      std::lock_guard< std::mutex > lock(queues_[index]->mutex_);
+      queues_[index]->tasks_.push_back(std::move(task));
+    }
+    pending_.fetch_add(1u, std::memory_order_release);
+    {
+      std::lock_guard< std::mutex > lock(sleepMutex_);
+    }
+    wakeUp_.notify_one();
+  }
+
+  bool ThreadPool::try_run_one()
+  {
+    task_t task;
+    std::size_t index = (currentPool == this) ? currentQueue : threads_.size();
+    if (!pop_task(index, task)) {
+      return false;
+    }
+    task();
+    return true;
+  }
+
+  std::size_t ThreadPool::size() const noexcept
+  {
+    return threads_.size();
+  }
+
+  ThreadPool& ThreadPool::global()
+  {
+    static ThreadPool pool(std::thread::hardware_concurrency() > 1u ? std::thread::hardware_concurrency() - 1u : 1u);
+    return pool;
+  }
+
+  void ThreadPool::run(std::size_t index)
+  {
+    currentPool = this;
+    currentQueue = index;
+    while (true) {
+      task_t task;
+      if (pop_task(index, task)) {
+        task();
+        continue;
+      }
+      std::unique_lock< std::mutex > lock(sleepMutex_);
+      wakeUp_.wait(lock, [this]() {
+        return stopping_ || pending_.load(std::memory_order_acquire) != 0u;
+      });
+      if (stopping_ && pending_.load(std::memory_order_acquire) == 0u) {
+        return;
+      }
+    }
+  }
+
+  bool ThreadPool::pop_task(std::size_t index, task_t& task)
+  {
+    if (pending_.load(std::memory_order_acquire) == 0u) {
+      return false;
+    }
+    {
+      WorkQueue& own = *queues_[index];
+      std::lock_guard< std::mutex > lock(own.mutex_);
+      if (!own.tasks_.empty()) {
+        task = std::move(own.tasks_.back());
+        own.tasks_.pop_back();
+        pending_.fetch_sub(1u, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    for (std::size_t i = 1u; i < queues_.size(); ++i) {
+      WorkQueue& victim = *queues_[(index + i) % queues_.size()];
+      std::lock_guard< std::mutex > lock(victim.mutex_);
+      if (!victim.tasks_.empty()) {
+        task = std::move(victim.tasks_.front());
+        victim.tasks_.pop_front();
+        pending_.fetch_sub(1u, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  TaskGroup::TaskGroup(ThreadPool& pool):
+    pool_(pool),
+    pending_(0u)
+  {}
+
+  TaskGroup::~TaskGroup()
+  {
+    drain();
+  }
+
+  void TaskGroup::wait()
+  {
+    drain();
+    std::lock_guard< std::mutex > lock(errorMutex_);
+    if (error_) {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  void TaskGroup::drain()
+  {
+    while (pending_.load(std::memory_order_acquire) != 0u) {
+      if (!pool_.try_run_one()) {
+        std::this_thread::yield();
+      }
+    }
+  }
+}
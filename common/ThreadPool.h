@@ -0,0 +1,91 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace siobko {
+  enum class ExecutionPolicy {
+    SEQUENTIAL,
+    PARALLEL
+  };
+
+  class ThreadPool {
+  public:
+    using task_t = std::function< void() >;
+
+    explicit ThreadPool(std::size_t threadsAmount = std::thread::hardware_concurrency());
+    ThreadPool(const ThreadPool& rhs) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    void submit(task_t task);
+    bool try_run_one();
+    std::size_t size() const noexcept;
+
+    static ThreadPool& global();
+
+  private:
+    struct WorkQueue {
+      std::mutex mutex_;
+      std::deque< task_t > tasks_;
+    };
+
+    void run(std::size_t index);
+    bool pop_task(std::size_t index, task_t& task);
+
+    std::vector< std::unique_ptr< WorkQueue > > queues_;
+    std::vector< std::thread > threads_;
+    std::atomic< std::size_t > pending_;
+    std::mutex sleepMutex_;
+    std::condition_variable wakeUp_;
+    bool stopping_;
+  };
+
+  class TaskGroup {
+  public:
+    explicit TaskGroup(ThreadPool& pool);
+    TaskGroup(const TaskGroup& rhs) = delete;
+    ~TaskGroup();
+
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+
+    template< typename Function >
+    void run(Function function);
+    void wait();
+
+  private:
+    void drain();
+
+    ThreadPool& pool_;
+    std::atomic< std::size_t > pending_;
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+  };
+
+  template< typename Function >
+  void TaskGroup::run(Function function)
+  {
+    pending_.fetch_add(1u, std::memory_order_relaxed);
+    pool_.submit([this, function]() mutable {
+      try {
+        function();
+      } catch (...) {
+        std::lock_guard< std::mutex > lock(errorMutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+      }
+      pending_.fetch_sub(1u, std::memory_order_release);
+    });
+  }
+}
+#endif
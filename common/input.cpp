@@ -1,6 +1,7 @@
 #include <input.h>
 
 #include <sstream>
+#include <algorithm>
 
 namespace siobko {
   std::deque< std::string > splitTextLine(const std::string& s, char delim)
@@ -55,4 +56,32 @@ namespace siobko {
     getline(fin, textLine);
     return splitTextLine(textLine, ' ');
   }
+
+  NumberScanner::NumberScanner(std::FILE *file, std::size_t bufferBytes):
+    file_(file),
+    buffer_(std::max< std::size_t >(256u, bufferBytes)),
+    position_(0u),
+    size_(0u),
+    eof_(false)
+  {}
+
+  bool NumberScanner::refill()
+  {
+    if (eof_) {
+      return false;
+    }
+    std::copy(buffer_.begin() + position_, buffer_.begin() + size_, buffer_.begin());
+    size_ -= position_;
+    position_ = 0u;
+    if (size_ == buffer_.size()) {
+      throw std::runtime_error("Input error: number is too long.");
+    }
+    std::size_t amount = std::fread(buffer_.data() + size_, 1u, buffer_.size() - size_, file_);
+    size_ += amount;
+    eof_ = (amount == 0u);
+    if (eof_ && std::ferror(file_)) {
+      throw std::runtime_error("Input error: cannot read file.");
+    }
+    return !eof_;
+  }
 }
@@ -6,6 +6,10 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <charconv>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
 
 namespace siobko {
   std::deque< std::string > splitTextLine(const std::string& s, char delim);
@@ -13,5 +17,81 @@ namespace siobko {
   std::deque< std::string > inputTextLine(std::istream& in);
   std::deque< std::string > inputTextLinesFromFile(std::ifstream& fin);
   std::deque< std::string > inputTextLineFromFile(std::ifstream& fin);
+
+  class NumberScanner {
+  public:
+    static constexpr std::size_t defaultBufferBytes = std::size_t(1) << 20;
+
+    explicit NumberScanner(std::FILE *file, std::size_t bufferBytes = defaultBufferBytes);
+
+    template< typename Ty >
+    bool next(Ty& value);
+
+  private:
+    static bool isSpace(char c) noexcept;
+    bool refill();
+
+    std::FILE *file_;
+    std::vector< char > buffer_;
+    std::size_t position_;
+    std::size_t size_;
+    bool eof_;
+  };
+
+  template< typename Ty >
+  std::vector< Ty > inputNumbers(std::FILE *file);
+
+  inline bool NumberScanner::isSpace(char c) noexcept
+  {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+  }
+
+  template< typename Ty >
+  bool NumberScanner::next(Ty& value)
+  {
+    while (true) {
+      while (position_ != size_ && isSpace(buffer_[position_])) {
+        ++position_;
+      }
+      if (position_ == size_) {
+        if (!refill()) {
+          return false;
+        }
+        continue;
+      }
+      std::size_t end = position_;
+      while (end != size_ && !isSpace(buffer_[end])) {
+        ++end;
+      }
+      if (end == size_ && !eof_) {
+        refill();
+        continue;
+      }
+      const char *first = buffer_.data() + position_;
+      const char *last = buffer_.data() + end;
+      if (*first == '+' && last - first > 1 && first[1] != '-') {
+        ++first;
+      }
+      auto result = std::from_chars(first, last, value);
+      if (result.ec != std::errc() || result.ptr != last) {
+        std::string token(buffer_.data() + position_, end - position_);
+        throw std::runtime_error("Input error: invalid number " + token + ".");
+      }
+      position_ = end;
+      return true;
+    }
+  }
+
+  template< typename Ty >
+  std::vector< Ty > inputNumbers(std::FILE *file)
+  {
+    NumberScanner scanner(file);
+    std::vector< Ty > numbers;
+    Ty value{};
+    while (scanner.next(value)) {
+      numbers.push_back(value);
+    }
+    return numbers;
+  }
 }
 #endif
@@ -1,5 +1,9 @@
 #include <output.h>
 
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
 namespace siobko {
   void printInvalidCommandErrorMessage(std::ostream& out)
   {
@@ -10,5 +14,104 @@ namespace siobko {
   {
     out << "<EMPTY>" << '\n';
   }
-}
 
+  OutputWriter::OutputWriter(std::ostream& out, std::size_t bufferBytes):
+    out_(&out),
+    file_(nullptr),
+    buffer_(std::max(2 * maxNumberLength, bufferBytes)),
+    size_(0u),
+    precision_(defaultPrecision)
+  {}
+
+  OutputWriter::OutputWriter(std::FILE *file, std::size_t bufferBytes):
+    out_(nullptr),
+    file_(file),
+    buffer_(std::max(2 * maxNumberLength, bufferBytes)),
+    size_(0u),
+    precision_(defaultPrecision)
+  {}
+
+  OutputWriter::~OutputWriter()
+  {
+    try {
+      flush();
+    } catch (...) {
+    }
+  }
+
+  OutputWriter& OutputWriter::operator<<(char c)
+  {
+    *reserve(1u) = c;
+    ++size_;
+    return *this;
+  }
+
+  OutputWriter& OutputWriter::operator<<(const char *str)
+  {
+    write(str, std::strlen(str));
+    return *this;
+  }
+
+  OutputWriter& OutputWriter::operator<<(const std::string& str)
+  {
+    write(str.data(), str.size());
+    return *this;
+  }
+
+  OutputWriter& OutputWriter::operator<<(double value)
+  {
+    char *first = reserve(maxNumberLength);
+    char *last = first + maxNumberLength;
+    if (precision_ == roundTripPrecision) {
+      size_ = std::to_chars(first, last, value).ptr - buffer_.data();
+    } else {
+      size_ = std::to_chars(first, last, value, std::chars_format::general, precision_).ptr - buffer_.data();
+    }
+    return *this;
+  }
+
+  void OutputWriter::write(const char *data, std::size_t size)
+  {
+    if (size >= buffer_.size()) {
+      flush();
+      writeThrough(data, size);
+      return;
+    }
+    std::memcpy(reserve(size), data, size);
+    size_ += size;
+  }
+
+  void OutputWriter::flush()
+  {
+    if (size_ == 0u) {
+      return;
+    }
+    std::size_t size = size_;
+    size_ = 0u;
+    writeThrough(buffer_.data(), size);
+  }
+
+  void OutputWriter::precision(int precision) noexcept
+  {
+    precision_ = std::min(precision, maxDoublePrecision);
+  }
+
+  void OutputWriter::writeThrough(const char *data, std::size_t size)
+  {
+    if (out_) {
+      if (!out_->write(data, size)) {
+        throw std::runtime_error("Output error: cannot write data.");
+      }
+    } else if (std::fwrite(data, 1u, size, file_) != size) {
+      throw std::runtime_error("Output error: cannot write data.");
+    }
+  }
+
+  char *OutputWriter::reserve(std::size_t size)
+  {
+    if (buffer_.size() - size_ < size) {
+      flush();
+    }
+    return buffer_.data() + size_;
+  }
+}
@@ -1,11 +1,64 @@
-
 #ifndef OUTPUT_H
 #define OUTPUT_H
 
 #include <iostream>
+#include <charconv>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace siobko {
   void printInvalidCommandErrorMessage(std::ostream& out);
   void printEmptyErrorMessage(std::ostream& out);
+
+  class OutputWriter {
+  public:
+    static constexpr std::size_t defaultBufferBytes = std::size_t(64) << 10;
+    static constexpr int defaultPrecision = 6;
+    static constexpr int roundTripPrecision = -1;
+
+    explicit OutputWriter(std::ostream& out, std::size_t bufferBytes = defaultBufferBytes);
+    explicit OutputWriter(std::FILE *file, std::size_t bufferBytes = defaultBufferBytes);
+    OutputWriter(const OutputWriter&) = delete;
+    ~OutputWriter();
+
+    OutputWriter& operator=(const OutputWriter&) = delete;
+
+    OutputWriter& operator<<(char c);
+    OutputWriter& operator<<(const char *str);
+    OutputWriter& operator<<(const std::string& str);
+    OutputWriter& operator<<(double value);
+
+    template< typename Integer >
+    typename std::enable_if< std::is_integral< Integer >::value && !std::is_same< Integer, char >::value
+        && !std::is_same< Integer, bool >::value, OutputWriter& >::type operator<<(Integer value);
+
+    void write(const char *data, std::size_t size);
+    void flush();
+    void precision(int precision) noexcept;
+
+  private:
+    static constexpr std::size_t maxNumberLength = 32u;
+    static constexpr int maxDoublePrecision = 17;
+
+    char *reserve(std::size_t size);
+    void writeThrough(const char *data, std::size_t size);
+
+    std::ostream *out_;
+    std::FILE *file_;
+    std::vector< char > buffer_;
+    std::size_t size_;
+    int precision_;
+  };
+
+  template< typename Integer >
+  typename std::enable_if< std::is_integral< Integer >::value && !std::is_same< Integer, char >::value
+      && !std::is_same< Integer, bool >::value, OutputWriter& >::type OutputWriter::operator<<(Integer value)
+  {
+    char *first = reserve(maxNumberLength);
+    size_ = std::to_chars(first, first + maxNumberLength, value).ptr - buffer_.data();
+    return *this;
+  }
 }
 #endif